@@ -32,10 +32,16 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <thread>
 #include <dlfcn.h>
 #include <dirent.h>
+#include <elf.h>
+#include <link.h>
 #include <unistd.h>
+#include "rrlib/xml/tDocument.h"
 #include "rrlib/xml/tNode.h"
 #include "core/tRuntimeEnvironment.h"
 #include "plugins/parameters/tConfigurablePlugin.h"
@@ -85,6 +91,7 @@ public:
 
   virtual void Init(rrlib::xml::tNode* config_node) override
   {
+    tCreateFrameworkElementAction::PublishUnregisteredActions(); // static objects of libraries loaded on startup are completely constructed now
     tFinstructable::StaticInit();
 
     /*! Port that receives administration requests */
@@ -164,13 +171,258 @@ public:
 
 static tRuntimeConstructionPlugin plugin;
 
+/*!
+ * Connection of a port in an element that is reloaded (see ReloadLibrary)
+ */
+struct tRecordedConnection
+{
+  /*! Qualified link of port in reloaded element */
+  std::string port_link;
+
+  /*! Qualified link of partner port - or link as stored in link edge */
+  std::string partner_link;
+
+  /*! Is partner the destination of the connection? (otherwise it is the source) */
+  bool partner_is_destination;
+
+  /*! Was connection created by finstruct? */
+  bool finstructed;
+
+  /*! Is connection a link edge? (then partner_link is the link edge's link) */
+  bool link_edge;
+};
+
+/*!
+ * Records all connections of ports below specified element
+ * (connections among these ports are only recorded once)
+ *
+ * \param element Element whose connections to record
+ * \param connections List to add connections to
+ */
+static void RecordConnections(core::tFrameworkElement& element, std::vector<tRecordedConnection>& connections)
+{
+  std::vector<tFinstructable::tLinkEdgeInfo> link_edges;
+  for (auto it = element.SubElementsBegin(true); it != element.SubElementsEnd(); ++it)
+  {
+    if ((!it->IsPort()) || (!it->IsReady()))
+    {
+      continue;
+    }
+    core::tAbstractPort& port = static_cast<core::tAbstractPort&>(*it);
+    std::string port_link = port.GetQualifiedLink();
+    for (auto destination = port.OutgoingConnectionsBegin(); destination != port.OutgoingConnectionsEnd(); ++destination)
+    {
+      connections.push_back(tRecordedConnection { port_link, destination->GetQualifiedLink(), true, port.IsEdgeFinstructed(*destination), false });
+    }
+    for (auto source = port.IncomingConnectionsBegin(); source != port.IncomingConnectionsEnd(); ++source)
+    {
+      if (!source->IsChildOf(element))  // otherwise recorded as outgoing connection of source
+      {
+        connections.push_back(tRecordedConnection { port_link, source->GetQualifiedLink(), false, source->IsEdgeFinstructed(port), false });
+      }
+    }
+    link_edges.clear();
+    tFinstructable::GetLinkEdges(port, link_edges);
+    for (const tFinstructable::tLinkEdgeInfo & link_edge : link_edges)
+    {
+      connections.push_back(tRecordedConnection { port_link, link_edge.link, link_edge.link_is_destination, link_edge.finstructed, true });
+    }
+  }
+}
+
+/*!
+ * Restores connections recorded with RecordConnections
+ *
+ * \param connections Recorded connections
+ * \return Number of connections that could not be restored
+ */
+static size_t RestoreConnections(const std::vector<tRecordedConnection>& connections)
+{
+  typedef core::tAbstractPort::tConnectDirection tConnectDirection;
+  core::tRuntimeEnvironment& runtime = core::tRuntimeEnvironment::GetInstance();
+  size_t failed = 0;
+  for (const tRecordedConnection & connection : connections)
+  {
+    core::tAbstractPort* port = runtime.GetPort(connection.port_link);
+    if (!port)
+    {
+      FINROC_LOG_PRINT_STATIC(WARNING, "Port '", connection.port_link, "' no longer exists after reload. Connection to '", connection.partner_link, "' is lost.");
+      failed++;
+      continue;
+    }
+    tConnectDirection direction = connection.partner_is_destination ? tConnectDirection::TO_TARGET : tConnectDirection::TO_SOURCE;
+    if (connection.link_edge)
+    {
+      // link edges may already have been restored (e.g. by finstructed children loaded with the element)
+      std::vector<tFinstructable::tLinkEdgeInfo> link_edges;
+      tFinstructable::GetLinkEdges(*port, link_edges);
+      bool exists = std::any_of(link_edges.begin(), link_edges.end(), [&](const tFinstructable::tLinkEdgeInfo & link_edge)
+      {
+        return link_edge.link == connection.partner_link && link_edge.link_is_destination == connection.partner_is_destination;
+      });
+      if (!exists)
+      {
+        port->ConnectTo(connection.partner_link, direction, connection.finstructed);
+      }
+      continue;
+    }
+    core::tAbstractPort* partner = runtime.GetPort(connection.partner_link);
+    if (!partner)
+    {
+      FINROC_LOG_PRINT_STATIC(WARNING, "Port '", connection.partner_link, "' no longer exists after reload. Connection to '", connection.port_link, "' is lost.");
+      failed++;
+      continue;
+    }
+    if (!port->IsConnectedTo(*partner))
+    {
+      port->ConnectTo(*partner, direction, connection.finstructed);
+    }
+  }
+  return failed;
+}
+
+/*!
+ * \param shared_library Shared library
+ * \return Number of existing elements created with create actions of specified library
+ */
+static int GetElementCount(const tSharedLibrary& shared_library)
+{
+  rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
+  int count = 0;
+  const tCreateFrameworkElementAction::tConstructibleElements& create_actions = tCreateFrameworkElementAction::GetConstructibleElements();
+  for (size_t i = 0; i < create_actions.size(); i++)
+  {
+    tCreateFrameworkElementAction* create_action = create_actions[i];
+    if (create_action && create_action->GetIdentity().module_group == shared_library)
+    {
+      count += create_action->GetElementCount();
+    }
+  }
+  return count;
+}
+
+/*!
+ * \param address Address to check
+ * \param shared_library Shared library
+ * \return Whether address is located in specified shared library
+ */
+static bool IsLocatedIn(const void* address, const tSharedLibrary& shared_library)
+{
+  Dl_info info;
+  return dladdr(address, &info) && info.dli_fname && tSharedLibrary(info.dli_fname) == shared_library;
+}
+
+/*!
+ * Looks for registrations of specified library that cannot be undone (plugins and data types).
+ * All plugins and data types that are currently registered are checked -
+ * including types that were registered lazily (and possibly by other threads) after the library was loaded.
+ * A data type is attributed to the library that contains its rtti name.
+ *
+ * \param shared_library Shared library
+ * \return Description of first permanent registration found - or empty string if there is none
+ */
+static std::string GetPermanentRegistration(const tSharedLibrary& shared_library)
+{
+  for (auto plugin : core::internal::tPlugins::GetInstance().GetPlugins())
+  {
+    if (IsLocatedIn(plugin, shared_library))
+    {
+      return "it contains a plugin";
+    }
+  }
+  size_t type_count = rrlib::rtti::tType::GetTypeCount();
+  for (size_t i = 0; i < type_count; i++)
+  {
+    rrlib::rtti::tType type = rrlib::rtti::tType::GetType(i);
+    if (type && IsLocatedIn(type.GetRttiName(), shared_library))
+    {
+      return "it registered data type '" + std::string(type.GetName()) + "'";
+    }
+  }
+  return "";
+}
+
+/*!
+ * Looks for properties of a loaded library that make the dynamic linker keep it loaded after dlclose:
+ * the library is linked with '-z nodelete' - or it defines symbols with STB_GNU_UNIQUE binding
+ * (GCC creates those e.g. for static variables in inline functions and templates unless code is compiled with '-fno-gnu-unique').
+ *
+ * \param handle Handle of library (as returned by dlopen)
+ * \return Description of first such property found - or empty string if there is none
+ */
+static std::string GetNoDeleteProperty(void* handle)
+{
+  struct link_map* link_map = NULL;
+  if (dlinfo(handle, RTLD_DI_LINKMAP, &link_map) || (!link_map))
+  {
+    return "";
+  }
+  for (const ElfW(Dyn)* entry = link_map->l_ld; entry && entry->d_tag != DT_NULL; entry++)
+  {
+    if (entry->d_tag == DT_FLAGS_1 && (entry->d_un.d_val & DF_1_NODELETE))
+    {
+      return "it is linked with '-z nodelete'";
+    }
+  }
+
+  // symbol bindings are only available in the library file's dynamic symbol table
+  std::ifstream file(link_map->l_name, std::ios::binary);
+  ElfW(Ehdr) header;
+  if (!(file.read(reinterpret_cast<char*>(&header), sizeof(header)) && memcmp(header.e_ident, ELFMAG, SELFMAG) == 0 && header.e_shentsize == sizeof(ElfW(Shdr))))
+  {
+    return "";
+  }
+  std::vector<ElfW(Shdr)> sections(header.e_shnum);
+  file.seekg(header.e_shoff);
+  if (!file.read(reinterpret_cast<char*>(sections.data()), sections.size() * sizeof(ElfW(Shdr))))
+  {
+    return "";
+  }
+  for (const ElfW(Shdr) & section : sections)
+  {
+    if (section.sh_type != SHT_DYNSYM || section.sh_entsize != sizeof(ElfW(Sym)) || section.sh_link >= sections.size())
+    {
+      continue;
+    }
+    std::vector<ElfW(Sym)> symbols(section.sh_size / sizeof(ElfW(Sym)));
+    std::vector<char> names(sections[section.sh_link].sh_size + 1, 0);
+    file.seekg(section.sh_offset);
+    file.read(reinterpret_cast<char*>(symbols.data()), symbols.size() * sizeof(ElfW(Sym)));
+    file.seekg(sections[section.sh_link].sh_offset);
+    file.read(names.data(), names.size() - 1);
+    if (!file)
+    {
+      return "";
+    }
+    for (const ElfW(Sym) & symbol : symbols)
+    {
+      if (ELF64_ST_BIND(symbol.st_info) == STB_GNU_UNIQUE && symbol.st_shndx != SHN_UNDEF)
+      {
+        std::string name = symbol.st_name < names.size() ? &names[symbol.st_name] : "?";
+        return "it defines symbol '" + name + "' with STB_GNU_UNIQUE binding (compile library with '-fno-gnu-unique')";
+      }
+    }
+  }
+  return "";
+}
+
+/*!
+ * \return Libraries that LoadComponentType tried to load
+ */
+static std::vector<tSharedLibrary>& LoadComponentTypeAttempts()
+{
+  static std::vector<tSharedLibrary> attempts;
+  return attempts;
+}
+
 }
 
 // closes dlopen-ed libraries
 class tDLCloser
 {
 public:
-  std::vector<void*> loaded;
+  /*! Handles of dlopen-ed libraries (in the order they were loaded) */
+  std::vector<std::pair<tSharedLibrary, void*>> loaded;
 
   tDLCloser() : loaded() {}
 
@@ -179,7 +431,7 @@ public:
     core::tRuntimeEnvironment::Shutdown();
     for (size_t i = 0; i < loaded.size(); i++)
     {
-      dlclose(loaded[i]);
+      dlclose(loaded[i].second);
     }
   }
 };
@@ -192,12 +444,65 @@ static inline unsigned int GetLongevity(tDLCloser*)
 
 typedef rrlib::design_patterns::tSingletonHolder<tDLCloser, rrlib::design_patterns::singleton::Longevity> tDLCloserInstance;
 
+void DLClose(const tSharedLibrary& shared_library)
+{
+  rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
+  tDLCloser& dl_closer = tDLCloserInstance::Instance();
+  auto entry = std::find_if(dl_closer.loaded.begin(), dl_closer.loaded.end(), [&](const std::pair<tSharedLibrary, void*>& loaded_library)
+  {
+    return loaded_library.first == shared_library;
+  });
+  if (entry == dl_closer.loaded.end())
+  {
+    throw std::runtime_error("Library '" + shared_library.ToString(true) + "' was not loaded dynamically");
+  }
+  std::string permanent_registration = internal::GetPermanentRegistration(shared_library);
+  if (permanent_registration.length())
+  {
+    throw std::runtime_error("Library '" + shared_library.ToString(true) + "' cannot be unloaded, as " + permanent_registration + " (such registrations cannot be undone)");
+  }
+  std::string no_delete_property = internal::GetNoDeleteProperty(entry->second);
+  if (no_delete_property.length())
+  {
+    throw std::runtime_error("Library '" + shared_library.ToString(true) + "' cannot be unloaded, as " + no_delete_property);
+  }
+  const tCreateFrameworkElementAction::tConstructibleElements& create_actions = tCreateFrameworkElementAction::GetConstructibleElements();
+  for (size_t i = 0; i < create_actions.size(); i++)
+  {
+    tCreateFrameworkElementAction* create_action = create_actions[i];
+    if (create_action && create_action->GetIdentity().module_group == shared_library && create_action->GetElementCount() > 0)
+    {
+      throw std::runtime_error("Library '" + shared_library.ToString(true) + "' is still in use: " + std::to_string(create_action->GetElementCount()) +
+                               " element(s) of type '" + create_action->GetIdentity().name + "' exist");
+    }
+  }
+
+  void* handle = entry->second;
+  dl_closer.loaded.erase(entry);
+  std::vector<tSharedLibrary>& attempts = internal::LoadComponentTypeAttempts();
+  attempts.erase(std::remove(attempts.begin(), attempts.end(), shared_library), attempts.end());
+  if (dlclose(handle))
+  {
+    throw std::runtime_error(std::string("Error from dlclose: ") + dlerror());
+  }
+
+  // library remains loaded if e.g. other libraries depend on it
+  void* still_loaded = dlopen(shared_library.ToString(true).c_str(), RTLD_NOW | RTLD_NOLOAD);
+  if (still_loaded)
+  {
+    dl_closer.loaded.emplace_back(shared_library, still_loaded); // library is still in use: keep handle so that it is closed on shutdown
+    throw std::runtime_error("Library '" + shared_library.ToString(true) + "' is still loaded after dlclose (possibly, other libraries depend on it)");
+  }
+}
+
 void DLOpen(const tSharedLibrary& shared_library)
 {
+  rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
   void* handle = dlopen(shared_library.ToString(true).c_str(), RTLD_NOW | RTLD_GLOBAL);
   if (handle)
   {
-    tDLCloserInstance::Instance().loaded.push_back(handle);
+    tDLCloserInstance::Instance().loaded.emplace_back(shared_library, handle);
+    tCreateFrameworkElementAction::PublishUnregisteredActions(); // static objects of library are completely constructed now
     core::internal::tPlugins::GetInstance().InitializeNewPlugins();
     return;
   }
@@ -325,15 +630,23 @@ std::vector<tSharedLibrary> GetLoadableFinrocLibraries()
 
 tCreateFrameworkElementAction& LoadComponentType(const tSharedLibrary& shared_library, const std::string& name)
 {
+  rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
+
   // contains all dynamically loaded .so files
-  static std::vector<tSharedLibrary> loaded;
+  std::vector<tSharedLibrary>& loaded = internal::LoadComponentTypeAttempts();
 
   // try to find component type among loaded ones
-  const std::vector<tCreateFrameworkElementAction*>& modules = tCreateFrameworkElementAction::GetConstructibleElements();
+  const size_t hash = tCreateFrameworkElementAction::ComputeHash(shared_library.ToString(), name);
+  const tCreateFrameworkElementAction::tConstructibleElements& modules = tCreateFrameworkElementAction::GetConstructibleElements();
   for (size_t i = 0u; i < modules.size(); i++)
   {
     tCreateFrameworkElementAction* cma = modules[i];
-    if (cma->GetModuleGroup() == shared_library && cma->GetName().compare(name) == 0)
+    if (!cma)
+    {
+      continue;
+    }
+    const tCreateFrameworkElementAction::tIdentity& identity = cma->GetIdentity();
+    if (identity.hash == hash && identity.module_group == shared_library && identity.name == name)
     {
       return *cma;
     }
@@ -364,6 +677,128 @@ tCreateFrameworkElementAction& LoadComponentType(const tSharedLibrary& shared_li
   throw std::runtime_error("No component type '" + name + "' available in '" + shared_library.ToString(true) + "'");
 }
 
+size_t ReloadLibrary(const tSharedLibrary& shared_library, rrlib::time::tDuration timeout)
+{
+  // serialize affected elements and record their connections
+  rrlib::xml::tDocument document;
+  rrlib::xml::tNode& root = document.AddRootNode("reload");
+  std::vector<std::pair<rrlib::xml::tNode*, core::tFrameworkElement::tHandle>> serialized_elements; // serialized element and handle of its parent
+  std::vector<internal::tRecordedConnection> connections;
+  {
+    rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
+
+    // check whether library can be unloaded at all - before any elements are deleted
+    const std::vector<std::pair<tSharedLibrary, void*>>& loaded = tDLCloserInstance::Instance().loaded;
+    auto entry = std::find_if(loaded.begin(), loaded.end(), [&](const std::pair<tSharedLibrary, void*>& loaded_library)
+    {
+      return loaded_library.first == shared_library;
+    });
+    if (entry == loaded.end())
+    {
+      throw std::runtime_error("Library '" + shared_library.ToString(true) + "' was not loaded dynamically");
+    }
+    std::string permanent_registration = internal::GetPermanentRegistration(shared_library);
+    if (permanent_registration.length())
+    {
+      throw std::runtime_error("Library '" + shared_library.ToString(true) + "' cannot be reloaded, as " + permanent_registration + " (such registrations cannot be undone)");
+    }
+    std::string no_delete_property = internal::GetNoDeleteProperty(entry->second);
+    if (no_delete_property.length())
+    {
+      throw std::runtime_error("Library '" + shared_library.ToString(true) + "' cannot be reloaded, as " + no_delete_property);
+    }
+
+    std::vector<core::tFrameworkElement*> affected_elements;
+    core::tFrameworkElement& runtime = core::tRuntimeEnvironment::GetInstance();
+    for (auto it = runtime.SubElementsBegin(); it != runtime.SubElementsEnd(); ++it)
+    {
+      tCreateFrameworkElementAction::tElementReference* reference = it->GetAnnotation<tCreateFrameworkElementAction::tElementReference>();
+      if (reference && it->IsReady() && reference->GetCreateAction().GetIdentity().module_group == shared_library)
+      {
+        bool child_of_affected_element = false;
+        for (core::tFrameworkElement * affected_element : affected_elements)
+        {
+          child_of_affected_element |= it->IsChildOf(*affected_element);
+        }
+        if (!child_of_affected_element)
+        {
+          affected_elements.push_back(&(*it));
+        }
+      }
+    }
+
+    for (core::tFrameworkElement * element : affected_elements)
+    {
+      FINROC_LOG_PRINT_STATIC(DEBUG, "Serializing '", element->GetQualifiedName(), "' for reload");
+      rrlib::xml::tNode* node = tFinstructable::SerializeElement(root, *element);
+      if (!node)
+      {
+        throw std::runtime_error("Library '" + shared_library.ToString(true) + "' cannot be reloaded, as element '" + element->GetQualifiedName() + "' cannot be serialized");
+      }
+      serialized_elements.emplace_back(node, element->GetParent()->GetHandle());
+      internal::RecordConnections(*element, connections);
+    }
+    for (core::tFrameworkElement * element : affected_elements)
+    {
+      element->ManagedDelete();
+    }
+  }
+
+  // wait until deleted elements have been released
+  rrlib::time::tTimestamp deadline = rrlib::time::Now() + timeout;
+  while (internal::GetElementCount(shared_library) > 0)
+  {
+    if (rrlib::time::Now() > deadline)
+    {
+      throw std::runtime_error("Reloading library '" + shared_library.ToString(true) + "' failed: deleted elements were not released in time");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  // reload library (structure mutex is held across unloading and loading - so that no other thread loads or unloads libraries in between)
+  std::string error_message;
+  try
+  {
+    rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
+    DLClose(shared_library);
+    DLOpen(shared_library);
+  }
+  catch (const std::exception& e)
+  {
+    error_message = e.what();
+    FINROC_LOG_PRINT_STATIC(ERROR, "Reloading library '", shared_library.ToString(true), "' failed: ", error_message);
+  }
+
+  // re-instantiate elements and restore their connections
+  size_t instantiated = 0;
+  {
+    rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
+    for (auto & serialized_element : serialized_elements)
+    {
+      const rrlib::xml::tNode& node = *serialized_element.first;
+      core::tFrameworkElement* parent = core::tRuntimeEnvironment::GetInstance().GetElement(serialized_element.second);
+      if (!parent)
+      {
+        FINROC_LOG_PRINT_STATIC(WARNING, "Parent of '", node.GetStringAttribute("name"), "' no longer exists. Element is not re-instantiated.");
+        continue;
+      }
+      if (tFinstructable::Instantiate(node, parent))
+      {
+        instantiated++;
+      }
+    }
+    size_t failed_connections = internal::RestoreConnections(connections);
+    FINROC_LOG_PRINT_STATIC(USER, "Reloaded library '", shared_library.ToString(true), "': ", instantiated, " element(s) re-instantiated, ",
+                            connections.size() - failed_connections, " of ", connections.size(), " connection(s) restored");
+  }
+
+  if (error_message.length())
+  {
+    throw std::runtime_error("Reloading library '" + shared_library.ToString(true) + "' failed: " + error_message);
+  }
+  return instantiated;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
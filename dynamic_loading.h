@@ -39,6 +39,7 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <set>
+#include "rrlib/time/time.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -61,9 +62,28 @@ namespace runtime_construction
 // Function declarations
 //----------------------------------------------------------------------
 
+// Note: Functions that load or unload libraries (DLOpen, DLClose, LoadComponentType, ReloadLibrary) may be called from different threads
+// (e.g. administration port and asynchronous jobs). They are serialized via the runtime's (recursive) structure mutex.
+
+/*!
+ * Unloads (dlclose) specified library that was previously loaded with DLOpen.
+ * This removes the library's create actions from the list of constructible elements
+ * (provided the library is not used by other libraries).
+ *
+ * \param shared_library Shared library to close
+ * \exception std::runtime_error is thrown if library cannot be unloaded:
+ *            because it was not loaded with DLOpen, because it contains plugins or registered data types (at any time),
+ *            because the dynamic linker would keep it loaded anyway (library is linked with '-z nodelete' or defines STB_GNU_UNIQUE symbols -
+ *            GCC creates those e.g. for static variables in inline functions and templates; compile with '-fno-gnu-unique' to avoid this)
+ *            or because framework elements created with its create actions still exist.
+ *            It is also thrown if the library is still loaded after dlclose (e.g. because other libraries depend on it).
+ */
+void DLClose(const tSharedLibrary& shared_library);
+
 /*!
  * dlopen specified library
  * (also takes care of closing library again on program shutdown)
+ * Acquires runtime's structure mutex while library is loaded and new plugins are initialized.
  *
  * \param shared_library Shared library to open
  * \exception std::runtime_error is thrown if dlopen fails
@@ -93,6 +113,7 @@ std::vector<tSharedLibrary> GetLoadableFinrocLibraries();
 /*!
  * Returns CreateFrameworkElementAction with specified name from specified shared library.
  * The shared library is dynamically loaded - unless it is already present.
+ * Acquires runtime's structure mutex.
  *
  * \param shared_library Shared library
  * \param name Module type name
@@ -102,6 +123,24 @@ std::vector<tSharedLibrary> GetLoadableFinrocLibraries();
  */
 tCreateFrameworkElementAction& LoadComponentType(const tSharedLibrary& shared_library, const std::string& name);
 
+/*!
+ * Reloads specified library (e.g. after it has been rebuilt) and re-instantiates all elements created with its create actions.
+ * Elements are serialized (constructor parameters, static parameters, finstructed children) and their connections are recorded.
+ * Then, the elements are deleted, the library is unloaded and loaded again (see DLClose and DLOpen),
+ * and the elements are instantiated and connected again.
+ * Must not be called with the runtime's structure mutex acquired (as deleted elements need to be released in the meantime).
+ * Libraries that contain plugins or registered data types cannot be reloaded - neither can libraries that the dynamic linker
+ * would not unload (linked with '-z nodelete' or containing STB_GNU_UNIQUE symbols - compile with '-fno-gnu-unique'; see DLClose).
+ * This is checked before any elements are deleted.
+ *
+ * \param shared_library Shared library to reload (must have been loaded with DLOpen)
+ * \param timeout Maximum time to wait for deleted elements to be released
+ * \return Number of re-instantiated elements
+ * \exception std::runtime_error is thrown if library could not be reloaded
+ *            (if elements have already been deleted, they are re-instantiated from the old library - if it is still loaded - or lost)
+ */
+size_t ReloadLibrary(const tSharedLibrary& shared_library, rrlib::time::tDuration timeout = std::chrono::seconds(5));
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
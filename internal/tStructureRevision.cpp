@@ -0,0 +1,125 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/runtime_construction/internal/tStructureRevision.cpp
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ */
+//----------------------------------------------------------------------
+#include "plugins/runtime_construction/internal/tStructureRevision.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "core/tRuntimeEnvironment.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace runtime_construction
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+tStructureRevision::tStructureRevision() :
+  revision(cINVALID_REVISION + 1),
+  child_revisions()
+{
+  core::tRuntimeEnvironment::GetInstance().AddListener(*this);
+}
+
+uint64_t tStructureRevision::Get()
+{
+  return Instance().revision.load();
+}
+
+uint64_t tStructureRevision::Get(const core::tFrameworkElement& parent)
+{
+  const tStructureRevision& instance = Instance();
+  auto entry = instance.child_revisions.find(&parent);
+  return entry != instance.child_revisions.end() ? entry->second : cINVALID_REVISION + 1;
+}
+
+tStructureRevision& tStructureRevision::Instance()
+{
+  // deliberately never deleted, as runtime environment may outlive static objects of this library
+  static tStructureRevision* instance = new tStructureRevision();
+  return *instance;
+}
+
+void tStructureRevision::OnEdgeChange(core::tRuntimeListener::tEvent change_type, core::tAbstractPort& source, core::tAbstractPort& target)
+{
+}
+
+void tStructureRevision::OnFrameworkElementChange(core::tRuntimeListener::tEvent change_type, core::tFrameworkElement& element)
+{
+  uint64_t new_revision = ++revision;
+  if (element.GetParent())
+  {
+    child_revisions[element.GetParent()] = new_revision;
+  }
+  if (change_type == core::tRuntimeListener::tEvent::REMOVE)
+  {
+    child_revisions.erase(&element);
+  }
+}
+
+void tStructureRevision::Register()
+{
+  Instance();
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,142 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/runtime_construction/internal/tStructureRevision.h
+ *
+ * \author  agent
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tStructureRevision
+ *
+ * \b tStructureRevision
+ *
+ * Counts changes to the application structure (framework elements added, changed or removed).
+ * Caches of structure information compare the current revision to the one they were created with.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__runtime_construction__internal__tStructureRevision_h__
+#define __plugins__runtime_construction__internal__tStructureRevision_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <unordered_map>
+#include "core/tRuntimeListener.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace runtime_construction
+{
+namespace internal
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Revision of application structure
+/*!
+ * Counts changes to the application structure (framework elements added, changed or removed).
+ * Caches of structure information compare the current revision to the one they were created with.
+ * Revisions are also tracked per parent element (see Get(parent)).
+ * Revision changes occur with the runtime's structure mutex acquired.
+ */
+class tStructureRevision : public core::tRuntimeListener
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Revision that is never current (may be used to mark caches invalid) */
+  static const uint64_t cINVALID_REVISION = 0;
+
+  /*!
+   * \return Current revision of application structure
+   */
+  static uint64_t Get();
+
+  /*!
+   * Revision of the child elements of a single framework element.
+   * It only changes if children of this element are added, changed or removed -
+   * so caches of e.g. a port group's ports are not invalidated by changes elsewhere in the application.
+   * Runtime's structure mutex must be acquired.
+   *
+   * \param parent Framework element
+   * \return Current revision of parent's child elements
+   */
+  static uint64_t Get(const core::tFrameworkElement& parent);
+
+  /*!
+   * Registers revision counter at runtime environment (if this has not happened yet).
+   * Must be called before relying on revision changes.
+   */
+  static void Register();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Current revision */
+  std::atomic<uint64_t> revision;
+
+  /*!
+   * Revision of child elements of each framework element whose children have changed since registration
+   * (entries are removed when framework element is removed; only accessed with runtime's structure mutex acquired)
+   */
+  std::unordered_map<const core::tFrameworkElement*, uint64_t> child_revisions;
+
+  tStructureRevision();
+
+  /*!
+   * \return Singleton instance (registered at runtime environment)
+   */
+  static tStructureRevision& Instance();
+
+  virtual void OnFrameworkElementChange(core::tRuntimeListener::tEvent change_type, core::tFrameworkElement& element) override;
+
+  virtual void OnEdgeChange(core::tRuntimeListener::tEvent change_type, core::tAbstractPort& source, core::tAbstractPort& target) override;
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+
+#endif
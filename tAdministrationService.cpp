@@ -32,6 +32,16 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <unordered_set>
+#include "rrlib/thread/tConditionVariable.h"
+#include "rrlib/thread/tThread.h"
+#include "rrlib/util/string.h"
 #include "core/tRuntimeEnvironment.h"
 #include "core/tRuntimeSettings.h"
 #include "plugins/data_ports/tGenericPort.h"
@@ -67,6 +77,43 @@ namespace runtime_construction
 //----------------------------------------------------------------------
 // Forward declarations / typedefs / enums
 //----------------------------------------------------------------------
+typedef tAdministrationService::tJobStatus tJobStatus;
+
+/*! Administration methods (for call statistics) */
+enum class tMethod
+{
+  CONNECT,
+  CONTROL_EXECUTION,
+  CREATE_MODULE,
+  CREATE_MODULE_ASYNCHRONOUSLY,
+  CREATE_MODULE_WITH_TYPE_UIDS,
+  DELETE_ELEMENT,
+  DISCONNECT,
+  DISCONNECT_ALL,
+  GET_ANNOTATION,
+  GET_CALL_STATISTICS,
+  GET_CREATE_MODULE_ACTIONS,
+  GET_JOB_STATUS,
+  GET_MODULE_LIBRARIES,
+  GET_PARAMETER_INFO,
+  GET_PARAMETER_INFO_PAGE,
+  GET_PORT_VALUES,
+  GET_TYPE_UID_TABLE,
+  IS_EXECUTING,
+  LOAD_MODULE_LIBRARY,
+  LOAD_MODULE_LIBRARY_ASYNCHRONOUSLY,
+  NETWORK_CONNECT,
+  PAUSE_EXECUTION,
+  RELOAD_MODULE_LIBRARY_ASYNCHRONOUSLY,
+  SAVE_ALL_FINSTRUCTABLE_FILES,
+  SAVE_ALL_FINSTRUCTABLE_FILES_ASYNCHRONOUSLY,
+  SAVE_FINSTRUCTABLE_GROUP,
+  SET_ANNOTATION,
+  SET_PORT_VALUE,
+  START_EXECUTION,
+  UNLOAD_MODULE_LIBRARY,
+  DIMENSION
+};
 
 //----------------------------------------------------------------------
 // Const values
@@ -79,10 +126,77 @@ static rpc_ports::tRPCInterfaceType<tAdministrationService> cTYPE("Administratio
     &tAdministrationService::GetModuleLibraries, &tAdministrationService::GetParameterInfo, &tAdministrationService::IsExecuting,
     &tAdministrationService::LoadModuleLibrary, &tAdministrationService::PauseExecution, &tAdministrationService::SaveAllFinstructableFiles,
     &tAdministrationService::SaveFinstructableGroup, &tAdministrationService::SetAnnotation, &tAdministrationService::SetPortValue,
-    &tAdministrationService::StartExecution, &tAdministrationService::NetworkConnect); // NetworkConnect is last in order to not break binary compatibility
+    &tAdministrationService::StartExecution, &tAdministrationService::NetworkConnect, // NetworkConnect and all following methods were appended in order to not break binary compatibility
+    &tAdministrationService::GetPortValues, &tAdministrationService::GetParameterInfoPage, &tAdministrationService::CreateModuleAsynchronously,
+    &tAdministrationService::GetJobStatus, &tAdministrationService::LoadModuleLibraryAsynchronously, &tAdministrationService::SaveAllFinstructableFilesAsynchronously,
+    &tAdministrationService::ControlExecution, &tAdministrationService::GetCallStatistics, &tAdministrationService::UnloadModuleLibrary,
+    &tAdministrationService::ReloadModuleLibraryAsynchronously, &tAdministrationService::GetTypeUidTable, &tAdministrationService::CreateModuleWithTypeUids);
 
 static tAdministrationService administration_service;
 
+/*! Maximum number of completed jobs whose results are kept for GetJobStatus */
+static const size_t cMAX_COMPLETED_JOBS = 64;
+
+/*! Name of administration method (for call statistics) */
+struct tMethodName
+{
+  tMethod method;
+  const char* name;
+};
+
+/*! Names of administration methods (for call statistics - must be in the same order as tMethod) */
+static constexpr tMethodName cMETHOD_NAMES[] =
+{
+  { tMethod::CONNECT, "Connect" },
+  { tMethod::CONTROL_EXECUTION, "ControlExecution" },
+  { tMethod::CREATE_MODULE, "CreateModule" },
+  { tMethod::CREATE_MODULE_ASYNCHRONOUSLY, "CreateModuleAsynchronously" },
+  { tMethod::CREATE_MODULE_WITH_TYPE_UIDS, "CreateModuleWithTypeUids" },
+  { tMethod::DELETE_ELEMENT, "DeleteElement" },
+  { tMethod::DISCONNECT, "Disconnect" },
+  { tMethod::DISCONNECT_ALL, "DisconnectAll" },
+  { tMethod::GET_ANNOTATION, "GetAnnotation" },
+  { tMethod::GET_CALL_STATISTICS, "GetCallStatistics" },
+  { tMethod::GET_CREATE_MODULE_ACTIONS, "GetCreateModuleActions" },
+  { tMethod::GET_JOB_STATUS, "GetJobStatus" },
+  { tMethod::GET_MODULE_LIBRARIES, "GetModuleLibraries" },
+  { tMethod::GET_PARAMETER_INFO, "GetParameterInfo" },
+  { tMethod::GET_PARAMETER_INFO_PAGE, "GetParameterInfoPage" },
+  { tMethod::GET_PORT_VALUES, "GetPortValues" },
+  { tMethod::GET_TYPE_UID_TABLE, "GetTypeUidTable" },
+  { tMethod::IS_EXECUTING, "IsExecuting" },
+  { tMethod::LOAD_MODULE_LIBRARY, "LoadModuleLibrary" },
+  { tMethod::LOAD_MODULE_LIBRARY_ASYNCHRONOUSLY, "LoadModuleLibraryAsynchronously" },
+  { tMethod::NETWORK_CONNECT, "NetworkConnect" },
+  { tMethod::PAUSE_EXECUTION, "PauseExecution" },
+  { tMethod::RELOAD_MODULE_LIBRARY_ASYNCHRONOUSLY, "ReloadModuleLibraryAsynchronously" },
+  { tMethod::SAVE_ALL_FINSTRUCTABLE_FILES, "SaveAllFinstructableFiles" },
+  { tMethod::SAVE_ALL_FINSTRUCTABLE_FILES_ASYNCHRONOUSLY, "SaveAllFinstructableFilesAsynchronously" },
+  { tMethod::SAVE_FINSTRUCTABLE_GROUP, "SaveFinstructableGroup" },
+  { tMethod::SET_ANNOTATION, "SetAnnotation" },
+  { tMethod::SET_PORT_VALUE, "SetPortValue" },
+  { tMethod::START_EXECUTION, "StartExecution" },
+  { tMethod::UNLOAD_MODULE_LIBRARY, "UnloadModuleLibrary" }
+};
+
+/*!
+ * \param index Index to start checking at
+ * \return Whether cMETHOD_NAMES contains all methods in the order of tMethod
+ */
+static constexpr bool MethodNamesInOrder(size_t index)
+{
+  return index == static_cast<size_t>(tMethod::DIMENSION) || (static_cast<size_t>(cMETHOD_NAMES[index].method) == index && MethodNamesInOrder(index + 1));
+}
+
+static_assert(sizeof(cMETHOD_NAMES) / sizeof(tMethodName) == static_cast<size_t>(tMethod::DIMENSION) && MethodNamesInOrder(0), "cMETHOD_NAMES must contain all methods in the order of tMethod");
+
+/*!
+ * Number of buckets in call duration histograms.
+ * Bucket 0 counts calls shorter than 1 microsecond, bucket i (i > 0) calls with durations in [2^(i-1), 2^i) microseconds.
+ * The last bucket counts all longer calls.
+ */
+enum { cHISTOGRAM_BUCKETS = 28 };
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
@@ -92,28 +206,702 @@ static core::tRuntimeEnvironment& Runtime()
   return core::tRuntimeEnvironment::GetInstance();
 }
 
+namespace internal
+{
+
+/*!
+ * Executes long-running administration operations in a separate thread -
+ * so that the RPC handler thread (and therefore the administration port) stays responsive.
+ * Jobs are executed one after the other in the order they were enqueued.
+ */
+class tJobExecutor
+{
+public:
+
+  /*! Asynchronous administration job */
+  struct tJob
+  {
+    /*! Operation to execute. Returns error message (empty if operation succeeded) and may fill result buffer and report progress */
+    std::function<std::string(tJob& job)> operation;
+
+    /*! Description of job (for log messages) */
+    std::string description;
+
+    /*! Current status of job */
+    tJobStatus status;
+
+    /*! Progress of job (0 to 1) */
+    std::atomic<float> progress;
+
+    /*! Error message (empty if job succeeded) */
+    std::string error_message;
+
+    /*! Result buffer (may be filled by operation) */
+    rrlib::serialization::tMemoryBuffer result;
+
+    tJob(const std::string& description, const std::function<std::string(tJob&)>& operation) :
+      operation(operation),
+      description(description),
+      status(tJobStatus::QUEUED),
+      progress(0),
+      error_message(),
+      result()
+    {}
+  };
+
+  tJobExecutor() :
+    mutex(),
+    condition(mutex),
+    queue(),
+    jobs(),
+    next_job_id(1),
+    stop(false),
+    thread()
+  {}
+
+  ~tJobExecutor()
+  {
+    {
+      rrlib::thread::tLock lock(mutex);
+      stop = true;
+      condition.NotifyAll(lock);
+    }
+    if (thread)
+    {
+      thread->Join();
+    }
+  }
+
+  /*!
+   * Enqueues job for execution
+   *
+   * \param description Description of job (for log messages)
+   * \param operation Operation to execute
+   * \return Id of job
+   */
+  int Enqueue(const std::string& description, const std::function<std::string(tJob&)>& operation)
+  {
+    rrlib::thread::tLock lock(mutex);
+    if (!thread)
+    {
+      thread.reset(new tExecutorThread(*this));
+      thread->Start();
+    }
+    int job_id = next_job_id++;
+    std::shared_ptr<tJob> job(new tJob(description, operation));
+    jobs[job_id] = job;
+    queue.push_back(job);
+    condition.NotifyAll(lock);
+    FINROC_LOG_PRINT(DEBUG, "Enqueued job ", job_id, ": ", description);
+    return job_id;
+  }
+
+  /*!
+   * \param job_id Id of job
+   * \return Serialized status of job (see tAdministrationService::GetJobStatus)
+   */
+  rrlib::serialization::tMemoryBuffer GetStatus(int job_id)
+  {
+    rrlib::serialization::tMemoryBuffer result_buffer;
+    rrlib::serialization::tOutputStream output_stream(result_buffer);
+    rrlib::thread::tLock lock(mutex);
+    auto it = jobs.find(job_id);
+    if (it == jobs.end())
+    {
+      output_stream.WriteByte(static_cast<uint8_t>(tJobStatus::UNKNOWN));
+      output_stream.WriteFloat(0);
+      output_stream.WriteString("");
+      output_stream << rrlib::serialization::tMemoryBuffer(0);
+    }
+    else
+    {
+      tJob& job = *it->second;
+      output_stream.WriteByte(static_cast<uint8_t>(job.status));
+      output_stream.WriteFloat(job.progress.load());
+      if (job.status == tJobStatus::COMPLETED)
+      {
+        output_stream.WriteString(job.error_message);
+        output_stream << job.result;
+      }
+      else
+      {
+        output_stream.WriteString("");
+        output_stream << rrlib::serialization::tMemoryBuffer(0);
+      }
+    }
+    output_stream.Close();
+    return result_buffer;
+  }
+
+private:
+
+  /*!
+   * Thread executing jobs
+   * (an rrlib thread - as jobs such as saving finstructable files rely on rrlib::thread::tThread::CurrentThread())
+   */
+  class tExecutorThread : public rrlib::thread::tThread
+  {
+  public:
+
+    tExecutorThread(tJobExecutor& executor) :
+      executor(executor)
+    {
+      SetName("Administration Jobs");
+    }
+
+    virtual void Run() override
+    {
+      executor.Run();
+    }
+
+  private:
+
+    /*! Executor whose jobs this thread executes */
+    tJobExecutor& executor;
+  };
+
+  /*! Mutex for all members */
+  rrlib::thread::tMutex mutex;
+
+  /*! Notified whenever a job is enqueued or executor is stopped */
+  rrlib::thread::tConditionVariable condition;
+
+  /*! Jobs waiting to be executed */
+  std::deque<std::shared_ptr<tJob>> queue;
+
+  /*! All jobs that are queued, running or have been completed recently (by id) */
+  std::map<int, std::shared_ptr<tJob>> jobs;
+
+  /*! Id of next job */
+  int next_job_id;
+
+  /*! Set when executor is to be stopped */
+  bool stop;
+
+  /*! Thread executing jobs (started with first job) */
+  std::unique_ptr<tExecutorThread> thread;
+
+  /*! Main loop of executor thread */
+  void Run()
+  {
+    rrlib::thread::tLock lock(mutex);
+    while (!stop)
+    {
+      if (queue.empty())
+      {
+        condition.Wait(lock);
+        continue;
+      }
+      std::shared_ptr<tJob> job = queue.front();
+      queue.pop_front();
+      job->status = tJobStatus::RUNNING;
+      lock.Unlock();
+
+      std::string error_message;
+      try
+      {
+        error_message = job->operation(*job);
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT(ERROR, e);
+        error_message = e.what();
+      }
+      FINROC_LOG_PRINT(USER, "Completed job '", job->description, "'", error_message.length() ? (": " + error_message) : std::string());
+
+      lock.Lock();
+      job->error_message = error_message;
+      job->progress = 1;
+      job->status = tJobStatus::COMPLETED;
+
+      // Forget results of old jobs
+      size_t completed_jobs = 0;
+      for (auto it = jobs.rbegin(); it != jobs.rend(); ++it)
+      {
+        completed_jobs += it->second->status == tJobStatus::COMPLETED ? 1 : 0;
+        if (completed_jobs > cMAX_COMPLETED_JOBS)
+        {
+          jobs.erase(jobs.begin(), it.base());
+          break;
+        }
+      }
+    }
+  }
+};
+
+static tJobExecutor job_executor;
+
+/*!
+ * Value of port obtained in GetPortValues
+ */
+struct tPortValue
+{
+  /*! Handle of port */
+  int handle;
+
+  /*! Data type of port */
+  rrlib::rtti::tType data_type;
+
+  /*! Locked buffer with port's current value */
+  data_ports::tPortDataPointer<const rrlib::rtti::tGenericObject> value;
+
+  tPortValue(int handle, const rrlib::rtti::tType& data_type, data_ports::tPortDataPointer<const rrlib::rtti::tGenericObject> && value) :
+    handle(handle),
+    data_type(data_type),
+    value(std::move(value))
+  {}
+};
+
+/*!
+ * Call statistics of a single administration method
+ * (updated concurrently without locking)
+ */
+struct tMethodStatistics
+{
+  /*! Number of calls */
+  std::atomic<uint64_t> call_count;
+
+  /*! Accumulated duration of all calls in nanoseconds */
+  std::atomic<uint64_t> total_duration;
+
+  /*! Maximum duration of a single call in nanoseconds */
+  std::atomic<uint64_t> max_duration;
+
+  /*! Accumulated time spent waiting for the structure mutex in nanoseconds */
+  std::atomic<uint64_t> total_lock_wait;
+
+  /*! Maximum time a single call waited for the structure mutex in nanoseconds */
+  std::atomic<uint64_t> max_lock_wait;
+
+  /*! Histogram of call durations (see cHISTOGRAM_BUCKETS) */
+  std::atomic<uint64_t> duration_histogram[cHISTOGRAM_BUCKETS];
+
+  tMethodStatistics() :
+    call_count(0),
+    total_duration(0),
+    max_duration(0),
+    total_lock_wait(0),
+    max_lock_wait(0)
+  {
+    for (size_t i = 0; i < cHISTOGRAM_BUCKETS; i++)
+    {
+      duration_histogram[i] = 0;
+    }
+  }
+};
+
+/*! Call statistics of all administration methods */
+static tMethodStatistics method_statistics[static_cast<size_t>(tMethod::DIMENSION)];
+
+/*!
+ * Sets atomic variable to value - if value is larger than the current one
+ */
+static inline void UpdateMaximum(std::atomic<uint64_t>& maximum, uint64_t value)
+{
+  uint64_t current = maximum.load();
+  while (value > current && (!maximum.compare_exchange_weak(current, value)))
+  {}
+}
+
+/*!
+ * Measures duration (and time waiting for the structure mutex) of an administration method call.
+ * Results are added to the method's statistics when object goes out of scope.
+ */
+class tCallMeasurement : private rrlib::util::tNoncopyable
+{
+public:
+
+  tCallMeasurement(tMethod method) :
+    statistics(method_statistics[static_cast<size_t>(method)]),
+    start(std::chrono::steady_clock::now()),
+    lock_wait_start(),
+    lock_wait(0)
+  {}
+
+  ~tCallMeasurement()
+  {
+    uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    statistics.call_count++;
+    statistics.total_duration += duration;
+    UpdateMaximum(statistics.max_duration, duration);
+    statistics.total_lock_wait += lock_wait;
+    UpdateMaximum(statistics.max_lock_wait, lock_wait);
+    size_t bucket = 0;
+    for (uint64_t microseconds = duration / 1000; microseconds > 0 && bucket < cHISTOGRAM_BUCKETS - 1; microseconds >>= 1)
+    {
+      bucket++;
+    }
+    statistics.duration_histogram[bucket]++;
+  }
+
+  /*!
+   * To be called directly before locking mutex
+   * (e.g. rrlib::thread::tLock lock(measurement.StartLockWait(mutex)); measurement.EndLockWait();)
+   *
+   * \param mutex Mutex that will be locked
+   * \return Mutex passed as argument
+   */
+  template <typename TMutex>
+  TMutex& StartLockWait(TMutex& mutex)
+  {
+    lock_wait_start = std::chrono::steady_clock::now();
+    return mutex;
+  }
+
+  /*!
+   * To be called directly after mutex has been acquired
+   */
+  void EndLockWait()
+  {
+    lock_wait += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - lock_wait_start).count();
+  }
+
+private:
+
+  /*! Statistics to add measurement to */
+  tMethodStatistics& statistics;
+
+  /*! Time when call started */
+  std::chrono::steady_clock::time_point start;
+
+  /*! Time when waiting for mutex started */
+  std::chrono::steady_clock::time_point lock_wait_start;
+
+  /*! Accumulated time spent waiting for mutexes (in nanoseconds) */
+  uint64_t lock_wait;
+};
+
+} // namespace
+
+/*!
+ * Saves all finstructable files in this runtime environment
+ * (Helper method for SaveAllFinstructableFiles and SaveAllFinstructableFilesAsynchronously)
+ *
+ * \param progress Progress is stored in this variable (may be null)
+ */
+static void SaveAllFinstructableFilesImplementation(std::atomic<float>* progress)
+{
+  FINROC_LOG_PRINT_STATIC(USER, "Saving all finstructable files in this process:");
+  core::tRuntimeEnvironment& runtime_environment = core::tRuntimeEnvironment::GetInstance();
+  std::vector<int> group_handles;
+  {
+    rrlib::thread::tLock lock(runtime_environment.GetStructureMutex());
+    for (auto it = runtime_environment.SubElementsBegin(); it != runtime_environment.SubElementsEnd(); ++it)
+    {
+      if (it->GetFlag(core::tFrameworkElement::tFlag::FINSTRUCTABLE_GROUP))
+      {
+        group_handles.push_back(it->GetHandle());
+      }
+    }
+  }
+
+  for (size_t i = 0; i < group_handles.size(); i++)
+  {
+    core::tFrameworkElement* group = runtime_environment.GetElement(group_handles[i]);
+    if (group && group->IsReady())
+    {
+      try
+      {
+        if (group->GetAnnotation<tFinstructable>())
+        {
+          group->GetAnnotation<tFinstructable>()->SaveXml();
+        }
+        else
+        {
+          FINROC_LOG_PRINT_STATIC(ERROR, "Element invalidly flagged as finstructable: ", group->GetQualifiedLink());
+        }
+      }
+      catch (const std::exception& e)
+      {
+        FINROC_LOG_PRINT_STATIC(ERROR, "Error saving finstructable group ", group->GetQualifiedLink());
+        FINROC_LOG_PRINT_STATIC(ERROR, e);
+      }
+    }
+    if (progress)
+    {
+      *progress = static_cast<float>(i + 1) / group_handles.size();
+    }
+  }
+  FINROC_LOG_PRINT_STATIC(USER, "Done.");
+}
+
+/*!
+ * Creates module
+ * (Helper method for CreateModule, CreateModuleAsynchronously and CreateModuleWithTypeUids)
+ *
+ * \param measurement Measurement of administration call
+ * \param create_action_index Index of create action
+ * \param module_name Name to give new module
+ * \param parent_handle Handle of parent element
+ * \param serialized_creation_parameters Serialized constructor parameters in case the module requires such - otherwise empty
+ * \param encoding Type encoding used in serialized constructor parameters
+ * \return Empty string if it worked - otherwise error message
+ */
+static std::string CreateModuleImplementation(internal::tCallMeasurement& measurement, uint32_t create_action_index, const std::string& module_name, int parent_handle,
+    const rrlib::serialization::tMemoryBuffer& serialized_creation_parameters, rrlib::serialization::tTypeEncoding encoding)
+{
+  std::string error_message;
+
+  try
+  {
+    rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex()));
+    measurement.EndLockWait();
+    const tCreateFrameworkElementAction::tConstructibleElements& create_actions = tCreateFrameworkElementAction::GetConstructibleElements();
+    if (create_action_index >= create_actions.size())
+    {
+      error_message = "Invalid construction action index";
+    }
+    else
+    {
+      tCreateFrameworkElementAction* create_action = create_actions[create_action_index];
+      core::tFrameworkElement* parent = core::tRuntimeEnvironment::GetInstance().GetElement(parent_handle);
+      if (!create_action)
+      {
+        error_message = "Construction action is no longer available (its library has been unloaded)";
+      }
+      else if (parent == NULL || (!parent->IsReady()))
+      {
+        error_message = "Parent not available. Cancelling remote module creation.";
+      }
+      else if ((!core::tRuntimeSettings::DuplicateQualifiedNamesAllowed()) && parent->GetChild(module_name))
+      {
+        error_message = std::string("Element with name '") + module_name + "' already exists. Creating another module with this name is not allowed.";
+      }
+      else
+      {
+        FINROC_LOG_PRINT_STATIC(USER, "Creating Module ", parent->GetQualifiedLink(), "/", module_name);
+        std::unique_ptr<tConstructorParameters> parameters;
+        const tConstructorParameters* parameter_types = create_action->GetParameterTypes();
+        if (parameter_types && parameter_types->Size() > 0)
+        {
+          parameters.reset(parameter_types->Instantiate());
+          rrlib::serialization::tInputStream input_stream(serialized_creation_parameters, encoding);
+          for (size_t i = 0; i < parameters->Size(); i++)
+          {
+            parameters::internal::tStaticParameterImplementationBase& parameter = parameters->Get(i);
+            try
+            {
+              parameter.DeserializeValue(input_stream);
+            }
+            catch (const std::exception& e)
+            {
+              error_message = "Error deserializing value for parameter " + parameter.GetName();
+              FINROC_LOG_PRINT_STATIC(ERROR, e);
+            }
+          }
+        }
+        core::tFrameworkElement* created = create_action->CreateModule(parent, module_name, parameters.get());
+        tFinstructable::SetFinstructed(*created, *create_action, std::move(parameters));
+        created->Init();
+        FINROC_LOG_PRINT_STATIC(USER, "Creating Module succeeded");
+      }
+    }
+  }
+  catch (const std::exception& e)
+  {
+    FINROC_LOG_PRINT_STATIC(ERROR, e);
+    error_message = e.what();
+  }
+
+  // Possibly print error message
+  if (error_message.size() > 0)
+  {
+    FINROC_LOG_PRINT_STATIC(ERROR, error_message);
+  }
+
+  return error_message;
+}
+
+/*!
+ * Serializes all create module actions
+ * (Helper method for GetCreateModuleActions and the library loading jobs)
+ *
+ * \param measurement Measurement of administration call
+ * \return Serialized create module actions
+ */
+static rrlib::serialization::tMemoryBuffer GetCreateModuleActionsImplementation(internal::tCallMeasurement& measurement)
+{
+  rrlib::serialization::tMemoryBuffer result_buffer;
+  rrlib::serialization::tOutputStream output_stream(result_buffer, rrlib::serialization::tTypeEncoding::NAMES);
+  rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex())); // libraries are not unloaded while we access their create actions
+  measurement.EndLockWait();
+  const tCreateFrameworkElementAction::tConstructibleElements& module_types = tCreateFrameworkElementAction::GetConstructibleElements();
+  for (size_t i = 0u; i < module_types.size(); i++)
+  {
+    if (!module_types[i])
+    {
+      // placeholder for unloaded or not yet registered create action (so that indices of all other actions remain valid)
+      output_stream.WriteString("");
+      output_stream.WriteString("");
+      output_stream.WriteBoolean(false);
+      continue;
+    }
+    const tCreateFrameworkElementAction& create_action = *module_types[i];
+    const tCreateFrameworkElementAction::tIdentity& identity = create_action.GetIdentity();
+    output_stream.WriteString(identity.name);
+    output_stream.WriteString(identity.module_group_name);
+    output_stream.WriteBoolean(create_action.GetParameterTypes());
+    if (create_action.GetParameterTypes())
+    {
+      output_stream << *create_action.GetParameterTypes();
+    }
+  }
+  output_stream.Close();
+  return result_buffer;
+}
+
+/*!
+ * Returns all relevant execution controls for start/stop command on specified element
+ * (Helper method for IsExecuting, StartExecution and PauseExecution)
+ *
+ * \param result Result buffer for list of execution controls
+ * \param element_handle Handle of element
+ */
+static void GetExecutionControls(std::vector<scheduling::tExecutionControl*>& result, int element_handle)
+{
+  core::tFrameworkElement* element = Runtime().GetElement(element_handle);
+  if (element)
+  {
+    scheduling::tExecutionControl::FindAll(result, *element);
+    if (result.size() == 0)
+    {
+      scheduling::tExecutionControl* control = scheduling::tExecutionControl::Find(*element);
+      if (control)
+      {
+        result.push_back(control);
+      }
+    }
+  }
+}
+
 /*!
  * Returns all relevant execution controls for start/stop command on specified element
- * (Helper method for IsExecuting, StartExecution and PauseExecution)
+ * (acquires structure mutex - measuring the time waiting for it)
  *
+ * \param measurement Measurement of administration call
  * \param result Result buffer for list of execution controls
  * \param element_handle Handle of element
  */
-static void GetExecutionControls(std::vector<scheduling::tExecutionControl*>& result, int element_handle)
+static void GetExecutionControls(internal::tCallMeasurement& measurement, std::vector<scheduling::tExecutionControl*>& result, int element_handle)
 {
-  core::tFrameworkElement* element = Runtime().GetElement(element_handle);
-  if (element)
+  rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex()));
+  measurement.EndLockWait();
+  GetExecutionControls(result, element_handle);
+}
+
+/*!
+ * Serializes parameter info of element and all elements below
+ * (Helper method for SerializeParameterInfo)
+ *
+ * \param output_stream Stream to serialize parameter info to
+ * \param element Element to serialize parameter info of
+ * \param config_file Config file responsible for root element
+ * \param parent_config_file Active config file responsible for element's parent
+ * \param remaining Remaining number of entries to serialize (-1 for no limit)
+ * \param link_filter Only elements whose qualified link starts with this string are included (empty string includes all)
+ * \param next_cursor If limit is reached, handle of next element to process is stored here
+ * \return False if limit was reached
+ */
+static bool SerializeParameterInfoSubtree(rrlib::serialization::tOutputStream& output_stream, core::tFrameworkElement& element, parameters::tConfigFile* config_file,
+    parameters::tConfigFile* parent_config_file, int& remaining, const std::string& link_filter, int& next_cursor)
+{
+  if (remaining == 0)
   {
-    scheduling::tExecutionControl::FindAll(result, *element);
-    if (result.size() == 0)
+    next_cursor = element.GetHandle();
+    return false;
+  }
+
+  parameters::tConfigFile* element_config = element.GetAnnotation<parameters::tConfigFile>();
+  parameters::tConfigFile* responsible_config = (element_config && element_config->IsActive()) ? element_config : parent_config_file;
+  std::string link = link_filter.length() > 0 ? element.GetQualifiedLink() : std::string();
+  if (link_filter.length() > 0 && (!rrlib::util::StartsWith(link, link_filter)) && (!rrlib::util::StartsWith(link_filter, link)))
+  {
+    return true; // neither this element nor any element below matches filter
+  }
+
+  if (link_filter.length() == 0 || rrlib::util::StartsWith(link, link_filter))
+  {
+    if (element_config)
     {
-      scheduling::tExecutionControl* control = scheduling::tExecutionControl::Find(*element);
-      if (control)
+      output_stream.WriteByte(1);
+      output_stream.WriteInt(element.GetHandle());
+      output_stream.WriteString(element_config->GetFilename());
+      output_stream.WriteBoolean(element_config->IsActive());
+      remaining = remaining > 0 ? remaining - 1 : remaining;
+    }
+    else
+    {
+      parameters::internal::tParameterInfo* parameter_info = element.GetAnnotation<parameters::internal::tParameterInfo>();
+      if (parameter_info && config_file == responsible_config)
       {
-        result.push_back(control);
+        output_stream.WriteByte(2);
+        output_stream.WriteInt(element.GetHandle());
+        output_stream.WriteString(parameter_info->GetConfigEntry());
+        remaining = remaining > 0 ? remaining - 1 : remaining;
+      }
+    }
+  }
+
+  for (auto child = element.ChildrenBegin(); child != element.ChildrenEnd(); ++child)
+  {
+    if (!SerializeParameterInfoSubtree(output_stream, *child, config_file, responsible_config, remaining, link_filter, next_cursor))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/*!
+ * Serializes parameter info of elements below root element (in depth-first order)
+ * (Helper method for GetParameterInfo and GetParameterInfoPage)
+ * Structure mutex must be acquired.
+ *
+ * \param output_stream Stream to serialize parameter info to
+ * \param root Root element
+ * \param config_file Config file responsible for root element
+ * \param cursor Handle of element to continue with (as returned by previous call) - or -1 to start with root element
+ * \param limit Maximum number of entries to serialize (-1 for no limit)
+ * \param link_filter Only elements whose qualified link starts with this string are included (empty string includes all)
+ * \return Cursor for the next call - or -1 if all elements have been processed
+ * \exception std::runtime_error is thrown if cursor does not refer to an element below root element (anymore)
+ */
+static int SerializeParameterInfo(rrlib::serialization::tOutputStream& output_stream, core::tFrameworkElement& root, parameters::tConfigFile* config_file,
+                                  int cursor, int limit, const std::string& link_filter)
+{
+  int remaining = limit;
+  int next_cursor = -1;
+  core::tFrameworkElement* element = cursor >= 0 ? Runtime().GetElement(cursor) : &root;
+  if ((!element) || (element != &root && (!element->IsChildOf(root))))
+  {
+    throw std::runtime_error("Element to continue with no longer exists below root element");
+  }
+
+  // process element to continue with - and afterwards all elements following it in depth-first order
+  parameters::tConfigFile* parent_config_file = element->GetParent() ? parameters::tConfigFile::Find(*element->GetParent()) : nullptr;
+  if (!SerializeParameterInfoSubtree(output_stream, *element, config_file, parent_config_file, remaining, link_filter, next_cursor))
+  {
+    return next_cursor;
+  }
+  while (element != &root)
+  {
+    core::tFrameworkElement* parent = element->GetParent();
+    parameters::tConfigFile* responsible_config = parameters::tConfigFile::Find(*parent);
+    auto sibling = parent->ChildrenBegin();
+    while (sibling != parent->ChildrenEnd() && &(*sibling) != element)
+    {
+      ++sibling;
+    }
+    for (++sibling; sibling != parent->ChildrenEnd(); ++sibling)
+    {
+      if (!SerializeParameterInfoSubtree(output_stream, *sibling, config_file, responsible_config, remaining, link_filter, next_cursor))
+      {
+        return next_cursor;
       }
     }
+    element = parent;
   }
+  return -1;
 }
 
 tAdministrationService::tAdministrationService()
@@ -124,6 +912,9 @@ tAdministrationService::~tAdministrationService()
 
 void tAdministrationService::Connect(int source_port_handle, int destination_port_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::CONNECT);
+  rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex())); // acquired by core anyway - acquired here to measure lock wait
+  measurement.EndLockWait();
   auto cVOLATILE = core::tFrameworkElement::tFlag::VOLATILE;
   core::tAbstractPort* source_port = Runtime().GetPort(source_port_handle);
   core::tAbstractPort* destination_port = Runtime().GetPort(destination_port_handle);
@@ -162,83 +953,92 @@ void tAdministrationService::Connect(int source_port_handle, int destination_por
   }
 }
 
-void tAdministrationService::CreateAdministrationPort()
-{
-  rpc_ports::tServerPort<tAdministrationService>(administration_service, cPORT_NAME, cTYPE,
-      &core::tRuntimeEnvironment::GetInstance().GetElement(core::tSpecialRuntimeElement::SERVICES));
-}
-
-std::string tAdministrationService::CreateModule(uint32_t create_action_index, const std::string& module_name, int parent_handle, const rrlib::serialization::tMemoryBuffer& serialized_creation_parameters)
+void tAdministrationService::ControlExecution(const rrlib::serialization::tMemoryBuffer& serialized_element_handles, bool start)
 {
-  std::string error_message;
-
-  try
+  internal::tCallMeasurement measurement(tMethod::CONTROL_EXECUTION);
+  // Collect all (distinct) execution controls first
+  std::vector<scheduling::tExecutionControl*> controls;
   {
-    rrlib::thread::tLock lock(Runtime().GetStructureMutex());
-    const std::vector<tCreateFrameworkElementAction*>& create_actions = tCreateFrameworkElementAction::GetConstructibleElements();
-    if (create_action_index >= create_actions.size())
-    {
-      error_message = "Invalid construction action index";
-    }
-    else
+    rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex()));
+    measurement.EndLockWait();
+    try
     {
-      tCreateFrameworkElementAction* create_action = create_actions[create_action_index];
-      core::tFrameworkElement* parent = core::tRuntimeEnvironment::GetInstance().GetElement(parent_handle);
-      if (parent == NULL || (!parent->IsReady()))
-      {
-        error_message = "Parent not available. Cancelling remote module creation.";
-      }
-      else if ((!core::tRuntimeSettings::DuplicateQualifiedNamesAllowed()) && parent->GetChild(module_name))
-      {
-        error_message = std::string("Element with name '") + module_name + "' already exists. Creating another module with this name is not allowed.";
-      }
-      else
+      rrlib::serialization::tInputStream input_stream(serialized_element_handles);
+      int count = input_stream.ReadInt();
+      std::vector<scheduling::tExecutionControl*> element_controls;
+      for (int i = 0; i < count; i++)
       {
-        FINROC_LOG_PRINT(USER, "Creating Module ", parent->GetQualifiedLink(), "/", module_name);
-        std::unique_ptr<tConstructorParameters> parameters;
-        if (create_action->GetParameterTypes() && create_action->GetParameterTypes()->Size() > 0)
+        element_controls.clear();
+        GetExecutionControls(element_controls, input_stream.ReadInt());
+        for (scheduling::tExecutionControl * control : element_controls)
         {
-          parameters.reset(create_action->GetParameterTypes()->Instantiate());
-          rrlib::serialization::tInputStream input_stream(serialized_creation_parameters, rrlib::serialization::tTypeEncoding::NAMES);
-          for (size_t i = 0; i < parameters->Size(); i++)
+          if (std::find(controls.begin(), controls.end(), control) == controls.end())
           {
-            parameters::internal::tStaticParameterImplementationBase& parameter = parameters->Get(i);
-            try
-            {
-              parameter.DeserializeValue(input_stream);
-            }
-            catch (const std::exception& e)
-            {
-              error_message = "Error deserializing value for parameter " + parameter.GetName();
-              FINROC_LOG_PRINT(ERROR, e);
-            }
+            controls.push_back(control);
           }
         }
-        core::tFrameworkElement* created = create_action->CreateModule(parent, module_name, parameters.get());
-        tFinstructable::SetFinstructed(*created, *create_action, parameters.get());
-        created->Init();
-        parameters.release();
-        FINROC_LOG_PRINT(USER, "Creating Module succeeded");
       }
     }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(WARNING, "Error deserializing element handles: ", e);
+    }
   }
-  catch (const std::exception& e)
+  if (controls.size() == 0)
   {
-    FINROC_LOG_PRINT(ERROR, e);
-    error_message = e.what();
+    FINROC_LOG_PRINT(WARNING, "Start/Pause command has no effect");
+    return;
   }
 
-  // Possibly print error message
-  if (error_message.size() > 0)
+  // Start/Pause them back-to-back
+  for (auto it = controls.begin(); it < controls.end(); it++)
   {
-    FINROC_LOG_PRINT(ERROR, error_message);
+    if (start && (!(*it)->IsRunning()))
+    {
+      (*it)->Start();
+    }
+    else if ((!start) && (*it)->IsRunning())
+    {
+      (*it)->Pause();
+    }
   }
+  FINROC_LOG_PRINT(USER, start ? "Started " : "Paused ", controls.size(), " execution controls");
+}
 
-  return error_message;
+void tAdministrationService::CreateAdministrationPort()
+{
+  rpc_ports::tServerPort<tAdministrationService>(administration_service, cPORT_NAME, cTYPE,
+      &core::tRuntimeEnvironment::GetInstance().GetElement(core::tSpecialRuntimeElement::SERVICES));
+}
+
+std::string tAdministrationService::CreateModule(uint32_t create_action_index, const std::string& module_name, int parent_handle, const rrlib::serialization::tMemoryBuffer& serialized_creation_parameters)
+{
+  internal::tCallMeasurement measurement(tMethod::CREATE_MODULE);
+  return CreateModuleImplementation(measurement, create_action_index, module_name, parent_handle, serialized_creation_parameters, rrlib::serialization::tTypeEncoding::NAMES);
+}
+
+int tAdministrationService::CreateModuleAsynchronously(uint32_t create_action_index, const std::string& module_name, int parent_handle, const rrlib::serialization::tMemoryBuffer& serialized_creation_parameters)
+{
+  std::shared_ptr<rrlib::serialization::tMemoryBuffer> parameters(new rrlib::serialization::tMemoryBuffer());
+  parameters->CopyFrom(serialized_creation_parameters);
+  return internal::job_executor.Enqueue("Create module " + module_name, [create_action_index, module_name, parent_handle, parameters](internal::tJobExecutor::tJob & job)
+  {
+    internal::tCallMeasurement measurement(tMethod::CREATE_MODULE_ASYNCHRONOUSLY);
+    return CreateModuleImplementation(measurement, create_action_index, module_name, parent_handle, *parameters, rrlib::serialization::tTypeEncoding::NAMES);
+  });
+}
+
+std::string tAdministrationService::CreateModuleWithTypeUids(uint32_t create_action_index, const std::string& module_name, int parent_handle, const rrlib::serialization::tMemoryBuffer& serialized_creation_parameters)
+{
+  internal::tCallMeasurement measurement(tMethod::CREATE_MODULE_WITH_TYPE_UIDS);
+  return CreateModuleImplementation(measurement, create_action_index, module_name, parent_handle, serialized_creation_parameters, rrlib::serialization::tTypeEncoding::LOCAL_UIDS);
 }
 
 void tAdministrationService::DeleteElement(int element_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::DELETE_ELEMENT);
+  rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex())); // acquired by core anyway - acquired here to measure lock wait
+  measurement.EndLockWait();
   core::tFrameworkElement* element = Runtime().GetElement(element_handle);
   if (element && (!element->IsDeleted()))
   {
@@ -253,6 +1053,9 @@ void tAdministrationService::DeleteElement(int element_handle)
 
 void tAdministrationService::Disconnect(int source_port_handle, int destination_port_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::DISCONNECT);
+  rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex())); // acquired by core anyway - acquired here to measure lock wait
+  measurement.EndLockWait();
   auto cVOLATILE = core::tFrameworkElement::tFlag::VOLATILE;
   core::tAbstractPort* source_port = Runtime().GetPort(source_port_handle);
   core::tAbstractPort* destination_port = Runtime().GetPort(destination_port_handle);
@@ -282,6 +1085,9 @@ void tAdministrationService::Disconnect(int source_port_handle, int destination_
 
 void tAdministrationService::DisconnectAll(int port_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::DISCONNECT_ALL);
+  rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex())); // acquired by core anyway - acquired here to measure lock wait
+  measurement.EndLockWait();
   core::tAbstractPort* port = Runtime().GetPort(port_handle);
   if (!port)
   {
@@ -294,11 +1100,12 @@ void tAdministrationService::DisconnectAll(int port_handle)
 
 rrlib::serialization::tMemoryBuffer tAdministrationService::GetAnnotation(int element_handle, const std::string& annotation_type_name)
 {
+  internal::tCallMeasurement measurement(tMethod::GET_ANNOTATION);
   core::tFrameworkElement* element = Runtime().GetElement(element_handle);
   rrlib::rtti::tType type = rrlib::rtti::tType::FindType(annotation_type_name);
   if (element && element->IsReady() && type != NULL)
   {
-    core::tAnnotation* result = element->GetAnnotation(type.GetRttiName());
+    const core::tAnnotation* result = element->GetAnnotation(type.GetRttiName());
     if (result)
     {
       rrlib::serialization::tMemoryBuffer result_buffer;
@@ -316,28 +1123,46 @@ rrlib::serialization::tMemoryBuffer tAdministrationService::GetAnnotation(int el
   return rrlib::serialization::tMemoryBuffer(0);
 }
 
-rrlib::serialization::tMemoryBuffer tAdministrationService::GetCreateModuleActions()
+rrlib::serialization::tMemoryBuffer tAdministrationService::GetCallStatistics()
 {
+  internal::tCallMeasurement measurement(tMethod::GET_CALL_STATISTICS);
   rrlib::serialization::tMemoryBuffer result_buffer;
-  rrlib::serialization::tOutputStream output_stream(result_buffer, rrlib::serialization::tTypeEncoding::NAMES);
-  const std::vector<tCreateFrameworkElementAction*>& module_types = tCreateFrameworkElementAction::GetConstructibleElements();
-  for (size_t i = 0u; i < module_types.size(); i++)
+  rrlib::serialization::tOutputStream output_stream(result_buffer);
+  output_stream.WriteInt(static_cast<int>(tMethod::DIMENSION));
+  output_stream.WriteInt(cHISTOGRAM_BUCKETS);
+  for (size_t i = 0; i < static_cast<size_t>(tMethod::DIMENSION); i++)
   {
-    const tCreateFrameworkElementAction& create_action = *module_types[i];
-    output_stream.WriteString(create_action.GetName());
-    output_stream.WriteString(create_action.GetModuleGroup().ToString());
-    output_stream.WriteBoolean(create_action.GetParameterTypes());
-    if (create_action.GetParameterTypes())
+    const internal::tMethodStatistics& statistics = internal::method_statistics[i];
+    output_stream.WriteString(cMETHOD_NAMES[i].name);
+    output_stream.WriteLong(statistics.call_count.load());
+    output_stream.WriteLong(statistics.total_duration.load());
+    output_stream.WriteLong(statistics.max_duration.load());
+    output_stream.WriteLong(statistics.total_lock_wait.load());
+    output_stream.WriteLong(statistics.max_lock_wait.load());
+    for (size_t j = 0; j < cHISTOGRAM_BUCKETS; j++)
     {
-      output_stream << *create_action.GetParameterTypes();
+      output_stream.WriteLong(statistics.duration_histogram[j].load());
     }
   }
   output_stream.Close();
   return result_buffer;
 }
 
+rrlib::serialization::tMemoryBuffer tAdministrationService::GetCreateModuleActions()
+{
+  internal::tCallMeasurement measurement(tMethod::GET_CREATE_MODULE_ACTIONS);
+  return GetCreateModuleActionsImplementation(measurement);
+}
+
+rrlib::serialization::tMemoryBuffer tAdministrationService::GetJobStatus(int job_id)
+{
+  internal::tCallMeasurement measurement(tMethod::GET_JOB_STATUS);
+  return internal::job_executor.GetStatus(job_id);
+}
+
 rrlib::serialization::tMemoryBuffer tAdministrationService::GetModuleLibraries()
 {
+  internal::tCallMeasurement measurement(tMethod::GET_MODULE_LIBRARIES);
   rrlib::serialization::tMemoryBuffer result_buffer;
   rrlib::serialization::tOutputStream output_stream(result_buffer);
   std::vector<tSharedLibrary> libs = GetLoadableFinrocLibraries();
@@ -351,6 +1176,7 @@ rrlib::serialization::tMemoryBuffer tAdministrationService::GetModuleLibraries()
 
 rrlib::serialization::tMemoryBuffer tAdministrationService::GetParameterInfo(int root_element_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::GET_PARAMETER_INFO);
   core::tFrameworkElement* root = Runtime().GetElement(root_element_handle);
   if ((!root) || (!root->IsReady()))
   {
@@ -370,27 +1196,140 @@ rrlib::serialization::tMemoryBuffer tAdministrationService::GetParameterInfo(int
     output_stream.WriteBoolean(true);
     output_stream.WriteInt(config_file->GetAnnotated<core::tFrameworkElement>()->GetHandle());
     output_stream << *config_file;
-    for (auto it = root->SubElementsBegin(true); it != root->SubElementsEnd(); ++it)
+    rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex()));
+    measurement.EndLockWait();
+    SerializeParameterInfo(output_stream, *root, config_file, -1, -1, "");
+  }
+  output_stream.Close();
+  return result_buffer;
+}
+
+rrlib::serialization::tMemoryBuffer tAdministrationService::GetParameterInfoPage(int root_element_handle, int cursor, int limit, const std::string& link_filter)
+{
+  internal::tCallMeasurement measurement(tMethod::GET_PARAMETER_INFO_PAGE);
+  core::tFrameworkElement* root = Runtime().GetElement(root_element_handle);
+  if ((!root) || (!root->IsReady()))
+  {
+    FINROC_LOG_PRINT(ERROR, "Could not get parameter info for framework element ", root_element_handle);
+    return rrlib::serialization::tMemoryBuffer(0);
+  }
+
+  parameters::tConfigFile* config_file = parameters::tConfigFile::Find(*root);
+  rrlib::serialization::tMemoryBuffer result_buffer;
+  rrlib::serialization::tOutputStream output_stream(result_buffer, rrlib::serialization::tTypeEncoding::NAMES);
+  if (!config_file)
+  {
+    output_stream.WriteBoolean(false);
+  }
+  else
+  {
+    output_stream.WriteBoolean(true);
+    output_stream.WriteInt(config_file->GetAnnotated<core::tFrameworkElement>()->GetHandle());
+    output_stream.WriteBoolean(cursor == -1);
+    if (cursor == -1)
+    {
+      output_stream << *config_file; // only with first page (config file does not need to be transferred again for every page)
+    }
+    int next_cursor = -1;
+    try
+    {
+      rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex()));
+      measurement.EndLockWait();
+      next_cursor = SerializeParameterInfo(output_stream, *root, config_file, cursor, limit, link_filter);
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(ERROR, "Could not continue getting parameter info: ", e.what());
+      return rrlib::serialization::tMemoryBuffer(0);
+    }
+    output_stream.WriteByte(0);
+    output_stream.WriteInt(next_cursor);
+  }
+  output_stream.Close();
+  return result_buffer;
+}
+
+rrlib::serialization::tMemoryBuffer tAdministrationService::GetPortValues(const rrlib::serialization::tMemoryBuffer& serialized_port_handles, int root_element_handle)
+{
+  internal::tCallMeasurement measurement(tMethod::GET_PORT_VALUES);
+  std::vector<internal::tPortValue> values;
+  {
+    // Structure lock is only held while ports are looked up and their current buffers are obtained (locked buffers remain valid after releasing it)
+    rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex()));
+    measurement.EndLockWait();
+    std::vector<core::tAbstractPort*> ports;
+    try
     {
-      parameters::tConfigFile* element_config = it->GetAnnotation<parameters::tConfigFile>();
-      if (element_config)
+      rrlib::serialization::tInputStream input_stream(serialized_port_handles);
+      int count = input_stream.ReadInt();
+      for (int i = 0; i < count; i++)
       {
-        output_stream.WriteByte(1);
-        output_stream.WriteInt(it->GetHandle());
-        output_stream.WriteString(element_config->GetFilename());
-        output_stream.WriteBoolean(element_config->IsActive());
+        core::tAbstractPort* port = Runtime().GetPort(input_stream.ReadInt());
+        if (port)
+        {
+          ports.push_back(port);
+        }
       }
-      else
+    }
+    catch (const std::exception& e)
+    {
+      FINROC_LOG_PRINT(WARNING, "Error deserializing port handles: ", e);
+    }
+    core::tFrameworkElement* root = root_element_handle >= 0 ? Runtime().GetElement(root_element_handle) : nullptr;
+    if (root && root->IsReady())
+    {
+      for (auto it = root->SubElementsBegin(); it != root->SubElementsEnd(); ++it)
       {
-        parameters::internal::tParameterInfo* parameter_info = it->GetAnnotation<parameters::internal::tParameterInfo>();
-        if (parameter_info && config_file == parameters::tConfigFile::Find(*it))
+        if (it->IsPort())
         {
-          output_stream.WriteByte(2);
-          output_stream.WriteInt(it->GetHandle());
-          output_stream.WriteString(parameter_info->GetConfigEntry());
+          ports.push_back(static_cast<core::tAbstractPort*>(&(*it)));
         }
       }
     }
+
+    std::unordered_set<core::tAbstractPort*> added_ports;
+    for (core::tAbstractPort * port : ports)
+    {
+      if ((!port->IsReady()) || (!dynamic_cast<data_ports::common::tAbstractDataPort*>(port)) || (!added_ports.insert(port).second))
+      {
+        continue;
+      }
+      data_ports::tGenericPort wrapped_port = data_ports::tGenericPort::Wrap(*port);
+      values.emplace_back(port->GetHandle(), port->GetDataType(), wrapped_port.GetPointer());
+    }
+  }
+
+  rrlib::serialization::tMemoryBuffer result_buffer;
+  rrlib::serialization::tOutputStream output_stream(result_buffer, rrlib::serialization::tTypeEncoding::NAMES);
+  output_stream.WriteInt(static_cast<int>(values.size()));
+  for (const internal::tPortValue & value : values)
+  {
+    output_stream.WriteInt(value.handle);
+    output_stream << value.data_type;
+    output_stream << rrlib::serialization::tDataEncoding::BINARY;
+    value.value->Serialize(output_stream, rrlib::serialization::tDataEncoding::BINARY);
+  }
+  output_stream.Close();
+  return result_buffer;
+}
+
+rrlib::serialization::tMemoryBuffer tAdministrationService::GetTypeUidTable(int first_uid)
+{
+  internal::tCallMeasurement measurement(tMethod::GET_TYPE_UID_TABLE);
+  rrlib::serialization::tMemoryBuffer result_buffer;
+  rrlib::serialization::tOutputStream output_stream(result_buffer);
+  {
+    // types of module libraries are registered while they are loaded - which is done with structure mutex acquired (see DLOpen)
+    rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex()));
+    measurement.EndLockWait();
+    const uint16_t type_count = rrlib::rtti::tType::GetTypeCount();  // only types with uids below this count are accessed
+    output_stream.WriteShort(type_count);
+    for (int uid = std::max(first_uid, 0); uid < type_count; uid++)
+    {
+      rrlib::rtti::tType type = rrlib::rtti::tType::GetType(static_cast<uint16_t>(uid));
+      output_stream.WriteShort(static_cast<int16_t>(uid));
+      output_stream.WriteString(type.GetName());
+    }
   }
   output_stream.Close();
   return result_buffer;
@@ -398,8 +1337,9 @@ rrlib::serialization::tMemoryBuffer tAdministrationService::GetParameterInfo(int
 
 tAdministrationService::tExecutionStatus tAdministrationService::IsExecuting(int element_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::IS_EXECUTING);
   std::vector<scheduling::tExecutionControl*> controls;
-  GetExecutionControls(controls, element_handle);
+  GetExecutionControls(measurement, controls, element_handle);
 
   bool stopped = false;
   bool running = false;
@@ -425,9 +1365,12 @@ tAdministrationService::tExecutionStatus tAdministrationService::IsExecuting(int
 
 rrlib::serialization::tMemoryBuffer tAdministrationService::LoadModuleLibrary(const std::string& library_name)
 {
+  internal::tCallMeasurement measurement(tMethod::LOAD_MODULE_LIBRARY);
   FINROC_LOG_PRINT(USER, "Loading library ", library_name);
   try
   {
+    rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex())); // acquired by DLOpen anyway - acquired here to measure lock wait
+    measurement.EndLockWait();
     DLOpen(library_name);
   }
   catch (const std::exception& exception)
@@ -437,9 +1380,32 @@ rrlib::serialization::tMemoryBuffer tAdministrationService::LoadModuleLibrary(co
   return GetCreateModuleActions();
 }
 
+int tAdministrationService::LoadModuleLibraryAsynchronously(const std::string& library_name)
+{
+  return internal::job_executor.Enqueue("Load library " + library_name, [this, library_name](internal::tJobExecutor::tJob & job)
+  {
+    internal::tCallMeasurement measurement(tMethod::LOAD_MODULE_LIBRARY_ASYNCHRONOUSLY);
+    FINROC_LOG_PRINT(USER, "Loading library ", library_name);
+    std::string error_message;
+    try
+    {
+      DLOpen(library_name);
+    }
+    catch (const std::exception& exception)
+    {
+      FINROC_LOG_PRINT(ERROR, exception);
+      error_message = exception.what();
+    }
+    rrlib::serialization::tMemoryBuffer create_module_actions = GetCreateModuleActionsImplementation(measurement);
+    job.result.CopyFrom(create_module_actions);
+    return error_message;
+  });
+}
+
 std::string tAdministrationService::NetworkConnect(int local_port_handle, const std::string& preferred_transport,
     const std::string& remote_runtime_uuid, int remote_port_handle, const std::string& remote_port_link, bool disconnect)
 {
+  internal::tCallMeasurement measurement(tMethod::NETWORK_CONNECT);
   // check local port
   auto cVOLATILE = core::tFrameworkElement::tFlag::VOLATILE;
   core::tAbstractPort* local_port = Runtime().GetPort(local_port_handle);
@@ -499,11 +1465,12 @@ std::string tAdministrationService::NetworkConnect(int local_port_handle, const
 
 void tAdministrationService::PauseExecution(int element_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::PAUSE_EXECUTION);
   std::vector<scheduling::tExecutionControl*> controls;
-  GetExecutionControls(controls, element_handle);
+  GetExecutionControls(measurement, controls, element_handle);
   if (controls.size() == 0)
   {
-    FINROC_LOG_PRINT(WARNING, "Start/Pause command has not effect");
+    FINROC_LOG_PRINT(WARNING, "Start/Pause command has no effect");
   }
   for (auto it = controls.begin(); it < controls.end(); it++)
   {
@@ -514,37 +1481,50 @@ void tAdministrationService::PauseExecution(int element_handle)
   }
 }
 
-void tAdministrationService::SaveAllFinstructableFiles()
+int tAdministrationService::ReloadModuleLibraryAsynchronously(const std::string& library_name)
 {
-  FINROC_LOG_PRINT(USER, "Saving all finstructable files in this process:");
-  core::tRuntimeEnvironment& runtime_environment = core::tRuntimeEnvironment::GetInstance();
-  for (auto it = runtime_environment.SubElementsBegin(); it != runtime_environment.SubElementsEnd(); ++it)
+  return internal::job_executor.Enqueue("Reload library " + library_name, [this, library_name](internal::tJobExecutor::tJob & job)
   {
-    if (it->GetFlag(core::tFrameworkElement::tFlag::FINSTRUCTABLE_GROUP))
+    internal::tCallMeasurement measurement(tMethod::RELOAD_MODULE_LIBRARY_ASYNCHRONOUSLY);
+    FINROC_LOG_PRINT(USER, "Reloading library ", library_name);
+    std::string error_message;
+    try
     {
-      try
-      {
-        if (it->GetAnnotation<tFinstructable>())
-        {
-          it->GetAnnotation<tFinstructable>()->SaveXml();
-        }
-        else
-        {
-          FINROC_LOG_PRINT(ERROR, "Element invalidly flagged as finstructable: ", it->GetQualifiedLink());
-        }
-      }
-      catch (const std::exception& e)
-      {
-        FINROC_LOG_PRINT(ERROR, "Error saving finstructable group ", it->GetQualifiedLink());
-        FINROC_LOG_PRINT(ERROR, e);
-      }
+      // structure mutex must not be held here: ReloadLibrary waits for deleted elements to be released
+      ReloadLibrary(library_name);
     }
-  }
-  FINROC_LOG_PRINT(USER, "Done.");
+    catch (const std::exception& exception)
+    {
+      FINROC_LOG_PRINT(ERROR, exception);
+      error_message = exception.what();
+    }
+    rrlib::serialization::tMemoryBuffer create_module_actions = GetCreateModuleActionsImplementation(measurement);
+    job.result.CopyFrom(create_module_actions);
+    return error_message;
+  });
+}
+
+void tAdministrationService::SaveAllFinstructableFiles()
+{
+  internal::tCallMeasurement measurement(tMethod::SAVE_ALL_FINSTRUCTABLE_FILES);
+  SaveAllFinstructableFilesImplementation(nullptr);
+}
+
+int tAdministrationService::SaveAllFinstructableFilesAsynchronously()
+{
+  return internal::job_executor.Enqueue("Save all finstructable files", [](internal::tJobExecutor::tJob & job)
+  {
+    internal::tCallMeasurement measurement(tMethod::SAVE_ALL_FINSTRUCTABLE_FILES_ASYNCHRONOUSLY);
+    SaveAllFinstructableFilesImplementation(&job.progress);
+    return std::string();
+  });
 }
 
 void tAdministrationService::SaveFinstructableGroup(int group_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::SAVE_FINSTRUCTABLE_GROUP);
+  rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex())); // acquired by core anyway - acquired here to measure lock wait
+  measurement.EndLockWait();
   core::tFrameworkElement* group = Runtime().GetElement(group_handle);
   if (group && group->IsReady() && group->GetFlag(core::tFrameworkElement::tFlag::FINSTRUCTABLE_GROUP))
   {
@@ -573,6 +1553,7 @@ void tAdministrationService::SaveFinstructableGroup(int group_handle)
 
 void tAdministrationService::SetAnnotation(int element_handle, const rrlib::serialization::tMemoryBuffer& serialized_annotation)
 {
+  internal::tCallMeasurement measurement(tMethod::SET_ANNOTATION);
   core::tFrameworkElement* element = Runtime().GetElement(element_handle);
   if (element == NULL || (!element->IsReady()))
   {
@@ -600,6 +1581,10 @@ void tAdministrationService::SetAnnotation(int element_handle, const rrlib::seri
       }
       else
       {
+        if (type == rrlib::rtti::tDataType<tConstructorParameters>())
+        {
+          static_cast<tConstructorParameters*>(annotation)->MakeExclusive();  // copy-on-write - so that other elements are not affected
+        }
         type.Deserialize(input_stream, annotation);
 
         // In case a new config entry is set (from finstruct), load it immediately
@@ -618,6 +1603,7 @@ void tAdministrationService::SetAnnotation(int element_handle, const rrlib::seri
 
 std::string tAdministrationService::SetPortValue(int port_handle, const rrlib::serialization::tMemoryBuffer& serialized_new_value)
 {
+  internal::tCallMeasurement measurement(tMethod::SET_PORT_VALUE);
   core::tAbstractPort* port = Runtime().GetPort(port_handle);
   std::string error_message;
   if (port && port->IsReady())
@@ -627,7 +1613,8 @@ std::string tAdministrationService::SetPortValue(int port_handle, const rrlib::s
       return "Port is read-only and cannot be set from finstruct";
     }
 
-    rrlib::thread::tLock lock(port->GetStructureMutex()); // TODO: obtaining structure lock is quite heavy-weight - however, set calls should not occur often
+    rrlib::thread::tLock lock(measurement.StartLockWait(port->GetStructureMutex())); // TODO: obtaining structure lock is quite heavy-weight - however, set calls should not occur often
+    measurement.EndLockWait();
     if (port->IsReady())
     {
       try
@@ -659,11 +1646,12 @@ std::string tAdministrationService::SetPortValue(int port_handle, const rrlib::s
 
 void tAdministrationService::StartExecution(int element_handle)
 {
+  internal::tCallMeasurement measurement(tMethod::START_EXECUTION);
   std::vector<scheduling::tExecutionControl*> controls;
-  GetExecutionControls(controls, element_handle);
+  GetExecutionControls(measurement, controls, element_handle);
   if (controls.size() == 0)
   {
-    FINROC_LOG_PRINT(WARNING, "Start/Pause command has not effect");
+    FINROC_LOG_PRINT(WARNING, "Start/Pause command has no effect");
   }
   for (auto it = controls.begin(); it < controls.end(); it++)
   {
@@ -674,6 +1662,24 @@ void tAdministrationService::StartExecution(int element_handle)
   }
 }
 
+std::string tAdministrationService::UnloadModuleLibrary(const std::string& library_name)
+{
+  internal::tCallMeasurement measurement(tMethod::UNLOAD_MODULE_LIBRARY);
+  FINROC_LOG_PRINT(USER, "Unloading library ", library_name);
+  try
+  {
+    rrlib::thread::tLock lock(measurement.StartLockWait(Runtime().GetStructureMutex()));
+    measurement.EndLockWait();
+    DLClose(library_name);
+  }
+  catch (const std::exception& exception)
+  {
+    FINROC_LOG_PRINT(ERROR, exception);
+    return exception.what();
+  }
+  return "";
+}
+
 
 //----------------------------------------------------------------------
 // End of namespace declaration
@@ -91,6 +91,17 @@ public:
     BOTH
   };
 
+  /*!
+   * Status of asynchronous administration jobs (returned by GetJobStatus)
+   */
+  enum class tJobStatus
+  {
+    UNKNOWN,   //!< There is no job with the specified id (anymore)
+    QUEUED,    //!< Job is waiting to be executed
+    RUNNING,   //!< Job is currently being executed
+    COMPLETED  //!< Job has been completed
+  };
+
 
   tAdministrationService();
 
@@ -105,6 +116,17 @@ public:
    */
   void Connect(int source_port_handle, int destination_port_handle);
 
+  /*!
+   * Starts or pauses execution of tasks in multiple framework elements
+   * (see StartExecution and PauseExecution).
+   * All relevant execution controls are collected first and are then started or paused back-to-back,
+   * which keeps the skew between multiple thread containers small.
+   *
+   * \param serialized_element_handles Serialized handles of framework elements (number of handles (int) followed by handles (int))
+   * \param start Start execution? (otherwise execution is paused)
+   */
+  void ControlExecution(const rrlib::serialization::tMemoryBuffer& serialized_element_handles, bool start);
+
   /*!
    * Instantiates port for administration
    */
@@ -121,6 +143,31 @@ public:
    */
   std::string CreateModule(uint32_t create_action_index, const std::string& module_name, int parent_handle, const rrlib::serialization::tMemoryBuffer& serialized_creation_parameters);
 
+  /*!
+   * Creates module asynchronously (see CreateModule)
+   * (the administration port stays responsive while heavy modules are created)
+   *
+   * \param create_action_index Index of create action
+   * \param module_name Name to give new module
+   * \param parent_handle Handle of parent element
+   * \param serialized_creation_parameters Serialized constructor parameters in case the module requires such - otherwise empty
+   * \return Id of job (status and error message can be obtained via GetJobStatus)
+   */
+  int CreateModuleAsynchronously(uint32_t create_action_index, const std::string& module_name, int parent_handle, const rrlib::serialization::tMemoryBuffer& serialized_creation_parameters);
+
+  /*!
+   * Creates module (see CreateModule).
+   * Types in serialized constructor parameters are encoded as local type uids of this runtime environment (see GetTypeUidTable) instead of names.
+   * This avoids resolving type names for every parameter when tools construct large parameterized graphs.
+   *
+   * \param create_action_index Index of create action
+   * \param module_name Name to give new module
+   * \param parent_handle Handle of parent element
+   * \param serialized_creation_parameters Serialized constructor parameters (type encoding LOCAL_UIDS) in case the module requires such - otherwise empty
+   * \return Empty string if it worked - otherwise error message
+   */
+  std::string CreateModuleWithTypeUids(uint32_t create_action_index, const std::string& module_name, int parent_handle, const rrlib::serialization::tMemoryBuffer& serialized_creation_parameters);
+
   /*!
    * Deletes specified framework element
    *
@@ -152,11 +199,32 @@ public:
    */
   rrlib::serialization::tMemoryBuffer GetAnnotation(int element_handle, const std::string& annotation_type_name);
 
+  /*!
+   * Call statistics of all administration methods since program start
+   * (e.g. to find out which tools put load on the administration service - and whether it causes jitter due to structure lock contention)
+   *
+   * \return Serialized statistics: number of methods (int), number of histogram buckets (int), and for each method:
+   *         name, call count, total duration, maximum duration, total time waiting for structure mutex, maximum time waiting for structure mutex (all durations as long in ns)
+   *         and call duration histogram (long for each bucket; bucket 0: < 1us, bucket i: [2^(i-1), 2^i) us, last bucket: all longer calls).
+   *         Each call is counted once: calls of *Asynchronously methods are counted (and timed) when their job is executed - not when the job is enqueued.
+   *         Time waiting for the structure mutex is measured for all methods that acquire it directly.
+   *         It is reported as zero for methods that do not acquire it (GetAnnotation, GetCallStatistics, GetJobStatus, GetModuleLibraries, SetAnnotation)
+   *         - and for NetworkConnect, SaveAllFinstructableFiles and SaveAllFinstructableFilesAsynchronously,
+   *         which acquire it (possibly multiple times) only inside network transport plugins or helper functions.
+   */
+  rrlib::serialization::tMemoryBuffer GetCallStatistics();
+
   /*!
    * \return All actions for creating framework element currently registered in this runtime environment - serialized
    */
   rrlib::serialization::tMemoryBuffer GetCreateModuleActions();
 
+  /*!
+   * \param job_id Id of job (as returned by one of the *Asynchronously methods)
+   * \return Serialized job status: status (tJobStatus as byte), progress (float from 0 to 1), error message (empty if job succeeded) and result buffer (only filled if job has completed)
+   */
+  rrlib::serialization::tMemoryBuffer GetJobStatus(int job_id);
+
   /*!
    * \return Available module libraries (.so files) that have not been loaded yet - serialized
    */
@@ -168,6 +236,45 @@ public:
    */
   rrlib::serialization::tMemoryBuffer GetParameterInfo(int root_element_handle);
 
+  /*!
+   * Paginated and filtered variant of GetParameterInfo
+   * (for large applications: obtains parameter info in chunks)
+   *
+   * \param root_element_handle Handle of root element to get parameter info below of
+   * \param cursor Cursor returned by the previous call (-1 for the first call).
+   *               The cursor is the handle of the element to continue with - so pages remain consistent if other parts of the structure change in between.
+   * \param limit Maximum number of entries to return (-1 for no limit)
+   * \param link_filter Only elements whose qualified link starts with this string are included (empty string includes all)
+   * \return Serialized parameter info in the same format as GetParameterInfo - followed by a zero byte and the cursor for the next call (-1 if there are no further entries).
+   *         The only difference: if there is a config file, its handle is followed by a boolean that tells whether the config file itself is included.
+   *         It is only included in the first page (cursor -1).
+   *         Empty buffer if the element that cursor refers to has been deleted in the meantime.
+   */
+  rrlib::serialization::tMemoryBuffer GetParameterInfoPage(int root_element_handle, int cursor, int limit, const std::string& link_filter);
+
+  /*!
+   * Obtains current values of multiple ports with a single call
+   * (e.g. for diagnostics tools that want to inspect many ports without subscribing to every port).
+   * Values are obtained one after another - so they are not guaranteed to be from the same point in time.
+   *
+   * \param serialized_port_handles Serialized handles of ports to get values of (number of handles (int) followed by handles (int))
+   * \param root_element_handle If this is a valid handle, values of all data ports below this element are included, too (-1 for none)
+   * \return Serialized port values: number of entries (int) followed by handle, data type, encoding and value of each port.
+   *         Every port is contained only once. Ports that are not available are skipped.
+   */
+  rrlib::serialization::tMemoryBuffer GetPortValues(const rrlib::serialization::tMemoryBuffer& serialized_port_handles, int root_element_handle);
+
+  /*!
+   * Obtains local type uids of this runtime environment (for CreateModuleWithTypeUids).
+   * Uids of registered types do not change - so tools only need to query types that have been added since their last call.
+   * The table is created with the structure mutex acquired, so it is consistent with module libraries that are loaded concurrently.
+   * The number of types is read once - so types registered while the table is created are included in the next call.
+   *
+   * \param first_uid First type uid to include (e.g. number of types obtained with last call)
+   * \return Serialized type table: total number of types (short), followed by uid (short) and name (string) of every type starting with first_uid
+   */
+  rrlib::serialization::tMemoryBuffer GetTypeUidTable(int first_uid);
+
   /*!
    * \param element_handle Handle of framework element
    * \return Is specified framework element currently executing?
@@ -182,6 +289,14 @@ public:
    */
   rrlib::serialization::tMemoryBuffer LoadModuleLibrary(const std::string& library_name);
 
+  /*!
+   * Dynamically loads specified module library asynchronously (see LoadModuleLibrary)
+   *
+   * \param library_name File name of library to load
+   * \return Id of job (result buffer of completed job contains the same as LoadModuleLibrary's return value)
+   */
+  int LoadModuleLibraryAsynchronously(const std::string& library_name);
+
   /*!
    * Connect local port to port in remote runtime environment using one of the
    * available network transport plugins.
@@ -205,11 +320,36 @@ public:
    */
   void PauseExecution(int element_handle);
 
+  /*!
+   * Reloads specified module library (.so file) asynchronously - e.g. after it has been rebuilt - without restarting the application.
+   * All framework elements created with the library's create actions are deleted and instantiated again from the reloaded library.
+   * Constructor parameters, static parameters, finstructed children and connections are preserved.
+   * Runtime parameter values set via config file or finstruct are loaded again; any other internal state is lost.
+   * Libraries that contain plugins or registered data types cannot be reloaded, as these registrations cannot be undone.
+   * Neither can libraries that the dynamic linker never unloads: libraries linked with '-z nodelete' - and libraries
+   * with STB_GNU_UNIQUE symbols, which GCC creates e.g. for static variables in inline functions and templates.
+   * Module libraries that are to be reloaded should therefore be compiled with '-fno-gnu-unique'.
+   * In these cases, the job fails before any elements are deleted. The job also fails if the library remains loaded after unloading
+   * (e.g. because other libraries depend on it).
+   *
+   * \param library_name File name of library to reload
+   * \return Id of job (result buffer of completed job contains the updated create module actions - see GetCreateModuleActions)
+   */
+  int ReloadModuleLibraryAsynchronously(const std::string& library_name);
+
   /*!
    * Saves all finstructable files in this runtime environment
    */
   void SaveAllFinstructableFiles();
 
+  /*!
+   * Saves all finstructable files in this runtime environment asynchronously
+   * (progress is the fraction of finstructable groups that have been saved)
+   *
+   * \return Id of job
+   */
+  int SaveAllFinstructableFilesAsynchronously();
+
   /*!
    * Save contents finstructable group to xml file
    *
@@ -242,6 +382,17 @@ public:
    */
   void StartExecution(int element_handle);
 
+  /*!
+   * Unloads specified module library (.so file) that was previously loaded dynamically.
+   * Its create actions are no longer available afterwards (entries in GetCreateModuleActions() remain as empty placeholders).
+   * Fails if framework elements created with the library's create actions still exist
+   * or if the library contains plugins or registered data types (these registrations cannot be undone).
+   *
+   * \param library_name File name of library to unload
+   * \return Empty string if it worked - otherwise error message
+   */
+  std::string UnloadModuleLibrary(const std::string& library_name);
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
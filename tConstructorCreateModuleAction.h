@@ -39,6 +39,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <type_traits>
 #include "rrlib/util/string.h"
 
 //----------------------------------------------------------------------
@@ -61,7 +62,11 @@ namespace runtime_construction
 namespace internal
 {
 
-/*! Helper to unroll tConstructorParameters */
+/*!
+ * Helper to unroll tConstructorParameters
+ * (arguments are passed to module constructor as const references to values in parameter storage - so they are copied at most once by the constructor itself.
+ *  For constructor arguments declared as non-const references, a copy of the value is passed - so that the parameter storage is never modified)
+ */
 template<typename TModule, int ARGNO, typename ... TArgs>
 struct tInstantiator; // make the compiler happy - see http://stackoverflow.com/questions/1989552/gcc-error-with-variadic-templates-sorry-unimplemented-cannot-expand-identif
 
@@ -72,7 +77,8 @@ struct tInstantiator<TModule, ARGNO, ARG1, TArgs...>
   inline static core::tFrameworkElement* Create(core::tFrameworkElement* parent, const std::string& name, tConstructorParameters* params, Args&... args)
   {
     typedef typename std::remove_reference<ARG1>::type tArgument;
-    tArgument arg = params->GetParameter<tArgument>(ARGNO);
+    typedef typename std::conditional < std::is_lvalue_reference<ARG1>::value && (!std::is_const<tArgument>::value), tArgument, const tArgument& >::type tLocalArgument;
+    tLocalArgument arg = params->GetParameterReference<tArgument>(ARGNO);
     return tInstantiator < TModule, ARGNO + 1, TArgs... >::Create(parent, name, params, args..., arg);
   }
 };
@@ -128,27 +134,18 @@ class tConstructorCreateModuleAction : public tCreateFrameworkElementAction
 //----------------------------------------------------------------------
 public:
 
+  /*!
+   * \param name Name of module type
+   * \param parameter_names Comma-separated list of constructor parameter names
+   *                        (parsed when parameter types are requested for the first time - so that registering actions is cheap)
+   */
   tConstructorCreateModuleAction(const std::string& name, const std::string& parameter_names) :
     type_name(name),
     group(GetBinary((void*)CreateModuleImplementation)),
+    parameter_names(parameter_names),
     constructor_parameters()
   {
-    // Create vector with parameter names
-    std::vector<std::string> names;
-    std::stringstream stream(parameter_names);
-    std::string parameter_name;
-    while (std::getline(stream, parameter_name, ','))
-    {
-      rrlib::util::TrimWhitespace(parameter_name);
-      names.push_back(parameter_name);
-    }
-
-    while (names.size() < std::tuple_size<tArgsTuple>::value)
-    {
-      names.push_back("Parameter " + std::to_string(names.size()));
-    }
-
-    internal::tParameterCreator<TArgs...>::CreateParameter(names, 0, constructor_parameters);
+    Register();
   }
 
   virtual core::tFrameworkElement* CreateModule(core::tFrameworkElement* parent, const std::string& name, tConstructorParameters* params) const override
@@ -168,6 +165,10 @@ public:
 
   virtual const tConstructorParameters* GetParameterTypes() const override
   {
+    std::call_once(constructor_parameters_created, [this]()
+    {
+      CreateConstructorParameters();
+    });
     return &constructor_parameters;
   }
 
@@ -182,8 +183,41 @@ private:
   /*! Name of module type */
   tSharedLibrary group;
 
-  /*! List with constructor parameters */
-  tConstructorParameters constructor_parameters;
+  /*! Comma-separated list of constructor parameter names */
+  std::string parameter_names;
+
+  /*! List with constructor parameters (prototype - created on first call to GetParameterTypes()) */
+  mutable tConstructorParameters constructor_parameters;
+
+  /*! Ensures that constructor parameters are created exactly once */
+  mutable std::once_flag constructor_parameters_created;
+
+  /*!
+   * Creates constructor parameter prototype from parameter names
+   */
+  void CreateConstructorParameters() const
+  {
+    // Create vector with parameter names
+    std::vector<std::string> names;
+    names.reserve(std::tuple_size<tArgsTuple>::value);
+    size_t start = 0;
+    while (start < parameter_names.length())
+    {
+      size_t end = parameter_names.find(',', start);
+      end = (end == std::string::npos) ? parameter_names.length() : end;
+      std::string parameter_name = parameter_names.substr(start, end - start);
+      rrlib::util::TrimWhitespace(parameter_name);
+      names.push_back(parameter_name);
+      start = end + 1;
+    }
+
+    while (names.size() < std::tuple_size<tArgsTuple>::value)
+    {
+      names.push_back("Parameter " + std::to_string(names.size()));
+    }
+
+    internal::tParameterCreator<TArgs...>::CreateParameter(names, 0, constructor_parameters);
+  }
 
   static core::tFrameworkElement* CreateModuleImplementation(core::tFrameworkElement* parent, const std::string& name, tConstructorParameters* params)
   {
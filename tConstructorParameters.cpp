@@ -32,6 +32,11 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "rrlib/serialization/serialization.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -62,6 +67,68 @@ namespace runtime_construction
 // Const values
 //----------------------------------------------------------------------
 
+namespace internal
+{
+
+/*!
+ * Registry with shared constructor parameter lists
+ * (key is create action index and serialized parameter values)
+ */
+struct tSharedParameterRegistry
+{
+  typedef std::pair<int, std::string> tKey;
+
+  /*! Shared parameter lists (expired entries are removed when registry has grown to twice its size after last cleanup) */
+  std::map<tKey, std::weak_ptr<tConstructorParameters>> entries;
+
+  /*! Number of entries after last cleanup */
+  size_t size_after_cleanup = 0;
+
+  /*! Mutex for registry access */
+  std::mutex mutex;
+
+  /*!
+   * \param create_action Index of create action that parameters were created for
+   * \param parameters Constructor parameters
+   * \return Shared parameter list with identical values (parameters if there is none yet)
+   */
+  std::shared_ptr<tConstructorParameters> Share(int create_action, std::unique_ptr<tConstructorParameters> parameters)
+  {
+    rrlib::serialization::tMemoryBuffer buffer;
+    rrlib::serialization::tOutputStream stream(buffer, rrlib::serialization::tTypeEncoding::NAMES);
+    stream << *parameters;
+    stream.Close();
+    tKey key(create_action, std::string(reinterpret_cast<const char*>(buffer.GetBufferPointer(0)), buffer.GetSize()));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::weak_ptr<tConstructorParameters>& entry = entries[key];
+    std::shared_ptr<tConstructorParameters> result = entry.lock();
+    if (!result)
+    {
+      result.reset(parameters.release());
+      entry = result;
+    }
+
+    if (entries.size() >= 2 * std::max<size_t>(size_after_cleanup, 16))
+    {
+      for (auto it = entries.begin(); it != entries.end();)
+      {
+        it = it->second.expired() ? entries.erase(it) : std::next(it);
+      }
+      size_after_cleanup = entries.size();
+    }
+    return result;
+  }
+};
+
+static tSharedParameterRegistry& SharedParameterRegistry()
+{
+  static tSharedParameterRegistry registry;
+  return registry;
+}
+
+}
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
@@ -69,9 +136,22 @@ namespace runtime_construction
 static rrlib::rtti::tDataType<tConstructorParameters> cTYPE;
 
 tConstructorParameters::tConstructorParameters() :
-  parameters::internal::tStaticParameterList()
+  parameters::internal::tStaticParameterList(),
+  shared_values()
 {}
 
+tConstructorParameters::~tConstructorParameters()
+{
+  // detach before shared values are possibly deleted (parameters are deleted by base class destructor - after shared_values)
+  if (shared_values)
+  {
+    for (size_t i = 0u; i < Size(); i++)
+    {
+      Get(i).AttachTo(NULL);
+    }
+  }
+}
+
 std::string tConstructorParameters::GetLogDescription() const
 {
   return "Constructor Parameters";
@@ -79,14 +159,43 @@ std::string tConstructorParameters::GetLogDescription() const
 
 tConstructorParameters* tConstructorParameters::Instantiate() const
 {
-  tConstructorParameters* cp = new tConstructorParameters();
+  std::unique_ptr<tConstructorParameters> cp(new tConstructorParameters());
   cp->SetCreateAction(this->GetCreateAction());
   for (size_t i = 0u; i < Size(); i++)
   {
-    parameters::internal::tStaticParameterImplementationBase& p = Get(i);
-    cp->Add(*p.DeepCopy());
+    cp->Add(*Get(i).DeepCopy());
+  }
+  return cp.release();
+}
+
+void tConstructorParameters::MakeExclusive()
+{
+  if (shared_values)
+  {
+    rrlib::serialization::tMemoryBuffer buffer;
+    rrlib::serialization::tOutputStream output_stream(buffer, rrlib::serialization::tTypeEncoding::NAMES);
+    output_stream << *shared_values;
+    output_stream.Close();
+    for (size_t i = 0u; i < Size(); i++)
+    {
+      Get(i).AttachTo(NULL);
+    }
+    shared_values.reset();
+    rrlib::serialization::tInputStream input_stream(buffer, rrlib::serialization::tTypeEncoding::NAMES);
+    input_stream >> *this;
+  }
+}
+
+std::unique_ptr<tConstructorParameters> tConstructorParameters::Share(int create_action, std::unique_ptr<tConstructorParameters> parameters)
+{
+  std::shared_ptr<tConstructorParameters> shared_values = internal::SharedParameterRegistry().Share(create_action, std::move(parameters));
+  std::unique_ptr<tConstructorParameters> result(shared_values->Instantiate());
+  for (size_t i = 0u; i < result->Size(); i++)
+  {
+    result->Get(i).AttachTo(&shared_values->Get(i));
   }
-  return cp;
+  result->shared_values = shared_values;
+  return result;
 }
 
 
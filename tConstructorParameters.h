@@ -41,6 +41,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <memory>
 #include "plugins/parameters/tStaticParameter.h"
 
 //----------------------------------------------------------------------
@@ -67,6 +68,12 @@ namespace runtime_construction
  * Parameters used to instantiate a module
  * are stored separately from static parameters.
  * Therefore, we need an extra class for this.
+ *
+ * Every framework element created with constructor parameters is annotated with its own list (see tFinstructable::SetFinstructed).
+ * As constructor parameters are immutable after module creation, elements created with the same create action and
+ * identical constructor parameter values share the values: they are stored once in a reference-counted list
+ * that the parameters of the elements' lists are attached to (see Share).
+ * If a tool changes the constructor parameters of one element, the values are copied first (copy-on-write - see MakeExclusive).
  */
 class tConstructorParameters : public parameters::internal::tStaticParameterList
 {
@@ -78,6 +85,9 @@ public:
 
   tConstructorParameters();
 
+  /*! Detaches parameters from shared values (see Share) */
+  ~tConstructorParameters();
+
   template <typename T, typename ... ARGS>
   void AddParameter(ARGS && ... args)
   {
@@ -89,8 +99,30 @@ public:
   template <typename T>
   T GetParameter(size_t index)
   {
-    tParameter<T> p(Get(index));
-    return p.Get();
+    return GetParameterReference<T>(index);
+  }
+
+  /*!
+   * \return Number of lists (elements) using the values of this list (1 if values are not shared)
+   */
+  long GetShareCount() const
+  {
+    return shared_values ? shared_values.use_count() : 1;
+  }
+
+  /*!
+   * Provides access to value of constructor parameter without copying it
+   * (preferable for large types such as matrices, lookup tables or long strings)
+   *
+   * \param index Index of parameter
+   * \return Reference to value in parameter's storage (valid as long as this parameter list exists and the value is not changed).
+   *         Note that the list passed to a create action is deleted after module creation if identical values are already shared (see Share) -
+   *         so module constructors must not keep references to constructor parameter values.
+   */
+  template <typename T>
+  const T& GetParameterReference(size_t index)
+  {
+    return Get(index).ValuePointer()->GetData<T>();
   }
 
   /*!
@@ -101,11 +133,31 @@ public:
    */
   tConstructorParameters* Instantiate() const;
 
+  /*!
+   * Makes values of this list exclusive to this list (copy-on-write):
+   * If values are shared with other lists (see Share), they are copied to this list's parameters - and the parameters are detached from the shared values.
+   * Must be called before modifying the values of a list that a framework element is annotated with.
+   */
+  void MakeExclusive();
+
+  /*!
+   * Creates the constructor parameter list that a framework element is annotated with (see tFinstructable::SetFinstructed).
+   * Lists with identical create action and parameter values share their values (see class description).
+   *
+   * \param create_action Index of create action that parameters were created for
+   * \param parameters Constructor parameters with values (become the shared values - or are deleted if identical values are already shared)
+   * \return Parameter list for element whose parameters are attached to the shared values
+   */
+  static std::unique_ptr<tConstructorParameters> Share(int create_action, std::unique_ptr<tConstructorParameters> parameters);
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
 private:
 
+  /*! List that stores the values of this list's parameters (null if values are stored in this list) */
+  std::shared_ptr<tConstructorParameters> shared_values;
+
   template <typename T>
   class tParameter : public parameters::tStaticParameter<T>
   {
@@ -32,6 +32,8 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <functional>
 #if __linux__
 #include <dlfcn.h>
 #endif
@@ -72,17 +74,87 @@ namespace runtime_construction
 namespace internal
 {
 
-std::vector<tCreateFrameworkElementAction*>& GetConstructibleElements()
+tCreateFrameworkElementAction::tConstructibleElements& GetConstructibleElements()
 {
-  static std::vector<tCreateFrameworkElementAction*> module_types;
+  static tCreateFrameworkElementAction::tConstructibleElements module_types;
   return module_types;
 }
 
 } // namespace
 
-tCreateFrameworkElementAction::tCreateFrameworkElementAction()
+tCreateFrameworkElementAction::tCreateFrameworkElementAction() :
+  index(internal::GetConstructibleElements().Reserve(*this)),
+  element_count(0),
+  identity(),
+  identity_initialized()
 {
-  internal::GetConstructibleElements().push_back(this);
+}
+
+tCreateFrameworkElementAction::~tCreateFrameworkElementAction()
+{
+  if (element_count.load())
+  {
+    FINROC_LOG_PRINT(ERROR, "Create action is deleted while ", element_count.load(), " elements created by it still exist.");
+  }
+  internal::GetConstructibleElements().Remove(*this);
+}
+
+tCreateFrameworkElementAction::tConstructibleElements::tConstructibleElements() :
+  published_size(0),
+  writer_mutex()
+{
+  for (size_t i = 0; i < cMAX_SEGMENTS; i++)
+  {
+    segments[i].store(NULL, std::memory_order_relaxed);
+  }
+}
+
+size_t tCreateFrameworkElementAction::tConstructibleElements::Reserve(tCreateFrameworkElementAction& action)
+{
+  std::lock_guard<std::mutex> lock(writer_mutex);
+  size_t index = published_size.load(std::memory_order_relaxed);
+  size_t segment_index = index / cSEGMENT_SIZE;
+  if (segment_index >= cMAX_SEGMENTS)
+  {
+    throw std::length_error("Maximum number of create actions exceeded");
+  }
+  std::atomic<tCreateFrameworkElementAction*>* segment = segments[segment_index].load(std::memory_order_relaxed);
+  if (!segment)
+  {
+    segment = new std::atomic<tCreateFrameworkElementAction*>[cSEGMENT_SIZE]();
+    segments[segment_index].store(segment, std::memory_order_release);
+  }
+  unregistered_actions.push_back(&action);
+  published_size.store(index + 1, std::memory_order_release);
+  return index;
+}
+
+void tCreateFrameworkElementAction::tConstructibleElements::Publish(tCreateFrameworkElementAction& action)
+{
+  std::lock_guard<std::mutex> lock(writer_mutex);
+  unregistered_actions.erase(std::remove(unregistered_actions.begin(), unregistered_actions.end(), &action), unregistered_actions.end());
+  std::atomic<tCreateFrameworkElementAction*>& entry = segments[action.index / cSEGMENT_SIZE].load(std::memory_order_acquire)[action.index % cSEGMENT_SIZE];
+  tCreateFrameworkElementAction* expected = NULL;
+  if (!entry.compare_exchange_strong(expected, &action, std::memory_order_release))
+  {
+    FINROC_LOG_PRINT_STATIC(WARNING, "Create action '", action.GetName(), "' has already been registered.");
+  }
+}
+
+void tCreateFrameworkElementAction::tConstructibleElements::Remove(tCreateFrameworkElementAction& action)
+{
+  std::lock_guard<std::mutex> lock(writer_mutex);
+  unregistered_actions.erase(std::remove(unregistered_actions.begin(), unregistered_actions.end(), &action), unregistered_actions.end());
+  std::atomic<tCreateFrameworkElementAction*>& entry = segments[action.index / cSEGMENT_SIZE].load(std::memory_order_relaxed)[action.index % cSEGMENT_SIZE];
+  assert(entry.load() == &action || entry.load() == NULL);
+  entry.store(NULL, std::memory_order_release);
+}
+
+size_t tCreateFrameworkElementAction::ComputeHash(const std::string& module_group_name, const std::string& name)
+{
+  std::hash<std::string> string_hash;
+  size_t hash = string_hash(module_group_name);
+  return hash ^ (string_hash(name) + 0x9e3779b9 + (hash << 6) + (hash >> 2));
 }
 
 tSharedLibrary tCreateFrameworkElementAction::GetBinary(void* addr)
@@ -97,11 +169,41 @@ tSharedLibrary tCreateFrameworkElementAction::GetBinary(void* addr)
 #endif
 }
 
-const std::vector<tCreateFrameworkElementAction*>& tCreateFrameworkElementAction::GetConstructibleElements()
+const tCreateFrameworkElementAction::tConstructibleElements& tCreateFrameworkElementAction::GetConstructibleElements()
 {
   return internal::GetConstructibleElements();
 }
 
+void tCreateFrameworkElementAction::PublishUnregisteredActions()
+{
+  tConstructibleElements& elements = internal::GetConstructibleElements();
+  std::lock_guard<std::mutex> lock(elements.writer_mutex);
+  for (tCreateFrameworkElementAction * action : elements.unregistered_actions)
+  {
+    FINROC_LOG_PRINT_STATIC(ERROR, "Create action '", action->GetName(), "' (", action->GetModuleGroup().ToString(),
+                            ") was not registered by its constructor. Its class must call Register() at the end of its constructor. Publishing it now.");
+    elements.segments[action->index / tConstructibleElements::cSEGMENT_SIZE].load(std::memory_order_relaxed)[action->index % tConstructibleElements::cSEGMENT_SIZE].store(action, std::memory_order_release);
+  }
+  elements.unregistered_actions.clear();
+}
+
+void tCreateFrameworkElementAction::Register()
+{
+  internal::GetConstructibleElements().Publish(*this);
+}
+
+const tCreateFrameworkElementAction::tIdentity& tCreateFrameworkElementAction::GetIdentity() const
+{
+  std::call_once(identity_initialized, [this]()
+  {
+    identity.module_group = GetModuleGroup();
+    identity.module_group_name = identity.module_group.ToString();
+    identity.name = GetName();
+    identity.hash = ComputeHash(identity.module_group_name, identity.name);
+  });
+  return identity;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -32,7 +32,12 @@
  * Classes that implement this interface provide a generic method for
  * creating modules/groups etc.
  *
- * When such actions are instantiated, they are automatically added to list of constructible elements.
+ * When such actions are instantiated, they are added to list of constructible elements.
+ * They become visible in this list once the most-derived class calls Register() at the end of its constructor
+ * (tStandardCreateModuleAction and tConstructorCreateModuleAction do this).
+ * Actions whose class does not call Register() are published with an error message once their
+ * shared library has been loaded completely (see PublishUnregisteredActions).
+ * When they are deleted (e.g. because their shared library is unloaded), they are removed from this list again.
  */
 //----------------------------------------------------------------------
 #ifndef __plugins__runtime_construction__tCreateFrameworkElementAction_h__
@@ -41,6 +46,9 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -68,7 +76,12 @@ namespace runtime_construction
  * Classes that implement this interface provide a generic method for
  * creating modules/groups etc.
  *
- * When such actions are instantiated, they are automatically added to list of constructible elements.
+ * When such actions are instantiated, they are added to list of constructible elements.
+ * They become visible in this list once the most-derived class calls Register() at the end of its constructor
+ * (tStandardCreateModuleAction and tConstructorCreateModuleAction do this).
+ * Actions whose class does not call Register() are published with an error message once their
+ * shared library has been loaded completely (see PublishUnregisteredActions).
+ * When they are deleted (e.g. because their shared library is unloaded), they are removed from this list again.
  */
 class tCreateFrameworkElementAction : private rrlib::util::tNoncopyable
 {
@@ -78,8 +91,149 @@ class tCreateFrameworkElementAction : private rrlib::util::tNoncopyable
 //----------------------------------------------------------------------
 public:
 
+  /*!
+   * Identity of create action: module group and type name.
+   * Determined once - on first access - from GetModuleGroup() and GetName() and immutable afterwards.
+   */
+  struct tIdentity
+  {
+    /*! Group (shared library) to which this create module action belongs */
+    tSharedLibrary module_group;
+
+    /*! Platform-independent name of module group (as serialized) */
+    std::string module_group_name;
+
+    /*! Name of module type to be created */
+    std::string name;
+
+    /*! Hash of module group name and type name (see ComputeHash) */
+    size_t hash;
+  };
+
+  /*!
+   * List of constructible elements (all create actions in this runtime).
+   * Append-only array of segments with an atomically published size:
+   * Looking up entries (size() and operator[]) is lock-free and never returns partially registered actions -
+   * also while a shared library is being loaded (and registers its actions) in another thread.
+   * Interface is a subset of std::vector's.
+   * Entries of removed create actions - and of actions not registered yet - are null (indices of other actions do not change).
+   * Create actions are only removed (and their libraries unloaded) with the runtime's structure mutex acquired.
+   * Therefore, code that uses a create action obtained from this list (beyond checking the entry for null)
+   * must hold the runtime's structure mutex until it no longer uses the action.
+   */
+  class tConstructibleElements : private rrlib::util::tNoncopyable
+  {
+  public:
+
+    tConstructibleElements();
+
+    /*!
+     * \param index Index of create action
+     * \return Create action with specified index (index must be smaller than size()). Null if create action has been removed.
+     */
+    tCreateFrameworkElementAction* operator[](size_t index) const
+    {
+      return segments[index / cSEGMENT_SIZE].load(std::memory_order_acquire)[index % cSEGMENT_SIZE].load(std::memory_order_acquire);
+    }
+
+    /*!
+     * \return Number of registered create actions
+     */
+    size_t size() const
+    {
+      return published_size.load(std::memory_order_acquire);
+    }
+
+  private:
+
+    friend class tCreateFrameworkElementAction;
+
+    /*! Number of create actions per segment */
+    enum { cSEGMENT_SIZE = 256 };
+
+    /*! Maximum number of segments */
+    enum { cMAX_SEGMENTS = 1024 };
+
+    /*! Segments (allocated when needed and never freed) */
+    std::atomic<std::atomic<tCreateFrameworkElementAction*>*> segments[cMAX_SEGMENTS];
+
+    /*! Number of create actions that readers may access */
+    std::atomic<size_t> published_size;
+
+    /*! Serializes registrations */
+    std::mutex writer_mutex;
+
+    /*! Actions with reserved entry that have not been published yet (only accessed with writer_mutex acquired) */
+    std::vector<tCreateFrameworkElementAction*> unregistered_actions;
+
+    /*!
+     * Reserves entry for a new create action (entry remains null until action is published)
+     *
+     * \param action Action that is being constructed
+     * \return Index of reserved entry
+     */
+    size_t Reserve(tCreateFrameworkElementAction& action);
+
+    /*!
+     * Publishes create action in its reserved entry
+     *
+     * \param action Fully constructed action to publish
+     */
+    void Publish(tCreateFrameworkElementAction& action);
+
+    /*!
+     * Removes create action from list
+     *
+     * \param action Action to remove
+     */
+    void Remove(tCreateFrameworkElementAction& action);
+  };
+
+  /*!
+   * Annotation for framework elements created with a create action (see tFinstructable::SetFinstructed).
+   * Counts the existing elements of each create action - so that the create action's library is not unloaded while they exist.
+   */
+  class tElementReference : public core::tAnnotation
+  {
+  public:
+
+    tElementReference(tCreateFrameworkElementAction& create_action) :
+      create_action(create_action)
+    {
+      create_action.element_count++;
+    }
+
+    ~tElementReference()
+    {
+      create_action.element_count--;
+    }
+
+    /*!
+     * \return Create action that annotated element was created with
+     */
+    tCreateFrameworkElementAction& GetCreateAction() const
+    {
+      return create_action;
+    }
+
+  private:
+
+    /*! Create action that annotated element was created with */
+    tCreateFrameworkElementAction& create_action;
+  };
+
   tCreateFrameworkElementAction();
 
+  /*! Removes create action from list of constructible elements */
+  virtual ~tCreateFrameworkElementAction();
+
+  /*!
+   * \param module_group_name Platform-independent name of module group
+   * \param name Name of module type
+   * \return Hash of module group and type name (as stored in tIdentity)
+   */
+  static size_t ComputeHash(const std::string& module_group_name, const std::string& name);
+
   /*!
    * Create Module (or Group)
    *
@@ -91,9 +245,20 @@ public:
   virtual core::tFrameworkElement* CreateModule(core::tFrameworkElement* parent, const std::string& name, tConstructorParameters* params = NULL) const = 0;
 
   /*!
+   * Note: This used to return a const std::vector<tCreateFrameworkElementAction*>&.
+   * Code declaring the result with that type needs to use tConstructibleElements (or auto) instead.
+   * size() and operator[] are unchanged - but entries may be null.
+   *
    * \return List with framework element types that can be instantiated in this runtime using this standard mechanism
    */
-  static const std::vector<tCreateFrameworkElementAction*>& GetConstructibleElements();
+  static const tConstructibleElements& GetConstructibleElements();
+
+  /*!
+   * Publishes all create actions whose class did not call Register() in its constructor - and prints an error message for each of them.
+   * Must only be called when no create actions are being constructed - e.g. after a shared library has been loaded
+   * (called by DLOpen and on initialization of this plugin - so this usually does not need to be called elsewhere).
+   */
+  static void PublishUnregisteredActions();
 
   /*!
    * \return Returns name of group to which this create module action belongs
@@ -105,6 +270,22 @@ public:
    */
   virtual std::string GetName() const = 0;
 
+  /*!
+   * \return Number of existing framework elements that were created with this action
+   */
+  int GetElementCount() const
+  {
+    return element_count.load();
+  }
+
+  /*!
+   * \return Index of this action in list of constructible elements (assigned on construction and never changed)
+   */
+  size_t GetIndex() const
+  {
+    return index;
+  }
+
   /*!
    * \return Returns types of parameters that the create method requires
    */
@@ -115,11 +296,45 @@ public:
    */
   tSharedLibrary GetBinary(void* addr);
 
+  /*!
+   * Module group and type name of this action - without copying any strings.
+   * Must not be called before derived class has been constructed.
+   *
+   * \return Identity of create action
+   */
+  const tIdentity& GetIdentity() const;
+
+//----------------------------------------------------------------------
+// Protected methods
+//----------------------------------------------------------------------
+protected:
+
+  /*!
+   * Publishes this action in list of constructible elements.
+   * Must be called at the end of the most-derived class's constructor - so that
+   * other threads never access a create action that is not fully constructed.
+   * Actions that are not registered are not available for creating elements
+   * until PublishUnregisteredActions() is called.
+   */
+  void Register();
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
 private:
 
+  /*! Index of this action in list of constructible elements */
+  const size_t index;
+
+  /*! Number of existing framework elements that were created with this action */
+  std::atomic<int> element_count;
+
+  /*! Identity of create action (initialized on first call of GetIdentity) */
+  mutable tIdentity identity;
+
+  /*! Ensures that identity is initialized exactly once */
+  mutable std::once_flag identity_initialized;
+
 };
 
 //----------------------------------------------------------------------
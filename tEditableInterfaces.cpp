@@ -37,7 +37,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
-#include "plugins/runtime_construction/tPortCreationList.h"
+#include "plugins/runtime_construction/internal/tStructureRevision.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -67,31 +67,142 @@ typedef core::tFrameworkElement::tFlags tFlags;
 //----------------------------------------------------------------------
 static rrlib::rtti::tDataType<tEditableInterfaces> cTYPE;
 
+/*! Byte value in serialized interface count indicating that the actual count follows as int (for 255 or more interfaces) */
+static const uint8_t cEXTENDED_INTERFACE_COUNT = 0xFF;
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
 
-void tEditableInterfaces::LoadInterfacePorts(const rrlib::xml::tNode& node)
+namespace internal
 {
-  std::string name = node.GetStringAttribute("name");
-  for (size_t i = 0; i < static_interface_info.size(); i++)
+
+/*!
+ * Writes number of interfaces to stream.
+ * Counts below 255 are written as a single byte (as in earlier versions) - larger counts as byte 255 followed by an int.
+ */
+static void WriteInterfaceCount(rrlib::serialization::tOutputStream& stream, size_t count)
+{
+  if (count < cEXTENDED_INTERFACE_COUNT)
+  {
+    stream.WriteByte(static_cast<uint8_t>(count));
+  }
+  else
+  {
+    stream.WriteByte(cEXTENDED_INTERFACE_COUNT);
+    stream.WriteInt(static_cast<int>(count));
+  }
+}
+
+/*!
+ * Reads number of interfaces from stream (see WriteInterfaceCount)
+ */
+static size_t ReadInterfaceCount(rrlib::serialization::tInputStream& stream)
+{
+  uint8_t count = stream.ReadByte();
+  if (count == cEXTENDED_INTERFACE_COUNT)
+  {
+    return static_cast<size_t>(stream.ReadInt());
+  }
+  return count;
+}
+
+}
+
+std::shared_ptr<const tEditableInterfaces::tSnapshot> tEditableInterfaces::GetSnapshot() const
+{
+  internal::tStructureRevision::Register();
+  std::shared_ptr<const tSnapshot> current_snapshot;
   {
-    if (name.compare(static_interface_info[i].name) == 0)
+    rrlib::thread::tLock lock(snapshot_mutex);
+    if (snapshot && snapshot_valid_revision == internal::tStructureRevision::Get())
     {
-      core::tPortGroup* port_group = interface_array[i];
+      return snapshot;
+    }
+    current_snapshot = snapshot;
+  }
 
-      // possibly create interface
-      if (!port_group)
+  // check current snapshot against per-parent revisions - or create new snapshot (snapshot_mutex must not be held while acquiring structure mutex)
+  std::shared_ptr<tSnapshot> new_snapshot(new tSnapshot());
+  uint64_t global_revision = 0;
+  {
+    rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex());
+    global_revision = internal::tStructureRevision::Get();
+    GetRevisions(new_snapshot->revisions);
+    if (current_snapshot && current_snapshot->revisions == new_snapshot->revisions)
+    {
+      // only other parts of the application have changed
+      rrlib::thread::tLock lock2(snapshot_mutex);
+      if (snapshot == current_snapshot)
+      {
+        snapshot_valid_revision = global_revision;
+      }
+      return current_snapshot;
+    }
+    for (size_t i = 0; i < static_interface_info.size(); i++)
+    {
+      new_snapshot->interfaces.emplace_back();
+      if (interface_array[i])
       {
-        CreateInterface(GetAnnotated<core::tFrameworkElement>(), i, GetAnnotated<core::tFrameworkElement>()->IsReady());
+        tPortCreationList port_creation_list(*interface_array[i], GetDefaultPortFlags(i), static_interface_info[i].selectable_create_options);
+        new_snapshot->interfaces.back().reset(new tPortCreationList());
+        port_creation_list.CreateSnapshot(*new_snapshot->interfaces.back());
+        if (new_snapshot->interfaces.back()->GetSize() == 0)
+        {
+          new_snapshot->interfaces.back().reset(); // serialize empty interfaces like placeholders
+        }
       }
+    }
+  }
+
+  rrlib::thread::tLock lock(snapshot_mutex);
+  if ((!snapshot) || snapshot == current_snapshot || snapshot_valid_revision <= global_revision)
+  {
+    snapshot = new_snapshot;
+    snapshot_valid_revision = global_revision;
+  }
+  return new_snapshot;
+}
+
+void tEditableInterfaces::GetRevisions(std::vector<uint64_t>& revisions) const
+{
+  revisions.clear();
+  revisions.reserve(static_interface_info.size() + 1);
+  revisions.push_back(internal::tStructureRevision::Get(*GetAnnotated<core::tFrameworkElement>()));
+  for (size_t i = 0; i < static_interface_info.size(); i++)
+  {
+    revisions.push_back(interface_array[i] ? internal::tStructureRevision::Get(*interface_array[i]) : internal::tStructureRevision::cINVALID_REVISION);
+  }
+}
+
+void tEditableInterfaces::InvalidateSnapshot()
+{
+  rrlib::thread::tLock lock(snapshot_mutex);
+  snapshot.reset();
+}
+
+void tEditableInterfaces::LoadInterfacePorts(const rrlib::xml::tNode& node)
+{
+  std::string name = node.GetStringAttribute("name");
+  int index = GetInterfaceIndex(name);
+  if (index < 0)
+  {
+    throw std::runtime_error("There is no editable interface called '" + name + "'");
+  }
 
-      tPortCreationList port_creation_list(*interface_array[i], GetDefaultPortFlags(i), static_interface_info[i].selectable_create_options);
-      node >> port_creation_list;
+  // possibly create interface (empty interfaces remain placeholders)
+  if (!interface_array[index])
+  {
+    if (node.ChildrenBegin() == node.ChildrenEnd())
+    {
       return;
     }
+    CreateInterface(GetAnnotated<core::tFrameworkElement>(), index, GetAnnotated<core::tFrameworkElement>()->IsReady());
   }
-  throw new std::runtime_error("There is no editable interface called '" + name + "'");
+
+  tPortCreationList port_creation_list(*interface_array[index], GetDefaultPortFlags(index), static_interface_info[index].selectable_create_options);
+  node >> port_creation_list;
+  InvalidateSnapshot();
 }
 
 void tEditableInterfaces::SaveAllNonEmptyInterfaces(rrlib::xml::tNode& parent_node)
@@ -129,19 +240,18 @@ void tEditableInterfaces::SaveInterfacePorts(rrlib::xml::tNode& node, size_t ind
 
 rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tEditableInterfaces& interfaces)
 {
-  rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex()); // no one should interfere
-  core::tPortGroup** current_interface_array = interfaces.interface_array;
+  // serialize snapshot - so that runtime's structure mutex is only acquired if structure has changed
+  std::shared_ptr<const tEditableInterfaces::tSnapshot> snapshot = interfaces.GetSnapshot();
 
-  stream.WriteByte(static_cast<uint8_t>(interfaces.static_interface_info.size())); // number of interfaces
+  internal::WriteInterfaceCount(stream, interfaces.static_interface_info.size());
   for (size_t i = 0; i < interfaces.static_interface_info.size(); i++)
   {
+    const std::unique_ptr<tPortCreationList>& interface_ports = snapshot->interfaces[i];
     stream.WriteString(interfaces.static_interface_info[i].name);
-    stream.WriteBoolean(*current_interface_array);
-    if (*current_interface_array)
+    stream.WriteBoolean(interface_ports.get());
+    if (interface_ports)
     {
-      tPortCreationList port_creation_list(**current_interface_array, interfaces.GetDefaultPortFlags(i),
-                                           interfaces.static_interface_info[i].selectable_create_options);
-      stream << port_creation_list;
+      stream << *interface_ports;
     }
     else
     {
@@ -152,7 +262,6 @@ rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputS
       }
       stream << selectable.Raw();
     }
-    current_interface_array++;
   }
   return stream;
 }
@@ -162,7 +271,7 @@ rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStr
   rrlib::thread::tLock lock(core::tRuntimeEnvironment::GetInstance().GetStructureMutex()); // no one should interfere
   core::tPortGroup** current_interface_array = interfaces.interface_array;
 
-  size_t size = stream.ReadByte();
+  size_t size = internal::ReadInterfaceCount(stream);
   if (size != interfaces.static_interface_info.size())
   {
     throw std::runtime_error("Error deserializing tEditableInterfaces: Wrong number of interfaces");
@@ -193,18 +302,27 @@ rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStr
     }
     else
     {
-      // possibly create interface
+      tPortCreationList entries;
+      stream >> entries;
+
+      // possibly create interface (empty interfaces remain placeholders)
       if (!(*current_interface_array))
       {
+        if (entries.GetSize() == 0)
+        {
+          current_interface_array++;
+          continue;
+        }
         interfaces.CreateInterface(interfaces.GetAnnotated<core::tFrameworkElement>(), i, interfaces.GetAnnotated<core::tFrameworkElement>()->IsReady());
       }
 
       tPortCreationList port_creation_list(**current_interface_array, interfaces.GetDefaultPortFlags(i),
                                            interfaces.static_interface_info[i].selectable_create_options);
-      stream >> port_creation_list;
+      port_creation_list.Synchronize(entries);
     }
     current_interface_array++;
   }
+  interfaces.InvalidateSnapshot();
   return stream;
 }
 
@@ -44,11 +44,13 @@
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
 #include <bitset>
+#include <memory>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/runtime_construction/tInterfaces.h"
+#include "plugins/runtime_construction/tPortCreationList.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -72,6 +74,7 @@ namespace runtime_construction
  * service to be more specific).
  *
  * Adding this annotation makes the specified interfaces editable.
+ * Interfaces remain placeholders (null in interface array) until ports are added to them.
  */
 class tEditableInterfaces : public tInterfaces
 {
@@ -122,6 +125,57 @@ public:
 //----------------------------------------------------------------------
 private:
 
+  friend rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tEditableInterfaces& interfaces);
+  friend rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStream& stream, tEditableInterfaces& interfaces);
+
+  /*!
+   * Read-side snapshot of all interfaces' ports.
+   * Is serialized to tools - so that this does not require the runtime's structure mutex.
+   * Snapshots are immutable once created.
+   */
+  struct tSnapshot
+  {
+    /*!
+     * Revisions of the child elements that snapshot was created for (see tStructureRevision::Get(parent)):
+     * Revision of the owning element's children (interfaces) followed by the revisions of each interface's children (ports)
+     */
+    std::vector<uint64_t> revisions;
+
+    /*! Port lists of interfaces (null if interface does not exist) */
+    std::vector<std::unique_ptr<tPortCreationList>> interfaces;
+  };
+
+  /*! Current snapshot (null if no snapshot has been created or if it has been invalidated) */
+  mutable std::shared_ptr<const tSnapshot> snapshot;
+
+  /*!
+   * Global structure revision that current snapshot was last found to be valid for.
+   * As long as the global revision has not changed, the snapshot is returned without acquiring the structure mutex.
+   * Otherwise, the snapshot is checked against the per-parent revisions - so changes elsewhere in the application do not cause new snapshots.
+   * (only accessed with snapshot_mutex acquired)
+   */
+  mutable uint64_t snapshot_valid_revision = 0;
+
+  /*! Mutex for snapshot pointer (only acquired very briefly - never while acquiring structure mutex) */
+  mutable rrlib::thread::tMutex snapshot_mutex;
+
+  /*!
+   * \return Snapshot that is valid for current revisions of owning element and interfaces (possibly created by this call)
+   */
+  std::shared_ptr<const tSnapshot> GetSnapshot() const;
+
+  /*!
+   * Obtains revisions of owning element's and interfaces' child elements (see tSnapshot::revisions).
+   * Runtime's structure mutex must be acquired.
+   *
+   * \param revisions Vector to store revisions in
+   */
+  void GetRevisions(std::vector<uint64_t>& revisions) const;
+
+  /*!
+   * Invalidates current snapshot (called when interfaces are modified)
+   */
+  void InvalidateSnapshot();
 };
 
 
@@ -32,6 +32,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <memory>
 #include <set>
 #include "rrlib/util/string.h"
 #include "core/file_lookup.h"
@@ -117,6 +118,19 @@ void tFinstructable::AddDependency(const rrlib::rtti::tType& dt)
   }
 }
 
+void tFinstructable::GetLinkEdges(const core::tAbstractPort& port, std::vector<tLinkEdgeInfo>& result)
+{
+  if (port.link_edges)
+  {
+    for (size_t i = 0u; i < port.link_edges->size(); i++)
+    {
+      core::internal::tLinkEdge* link_edge = (*port.link_edges)[i];
+      bool source_link = link_edge->GetSourceLink().length() > 0;
+      result.push_back(tLinkEdgeInfo { source_link ? link_edge->GetSourceLink() : link_edge->GetTargetLink(), !source_link, link_edge->IsFinstructed() });
+    }
+  }
+}
+
 void tFinstructable::AnnotatedObjectInitialized()
 {
   if (!GetFrameworkElement()->GetFlag(tFlag::FINSTRUCTABLE_GROUP))
@@ -173,7 +187,7 @@ std::string tFinstructable::GetXmlFileString()
   return s;
 }
 
-void tFinstructable::Instantiate(const rrlib::xml::tNode& node, tFrameworkElement* parent)
+core::tFrameworkElement* tFinstructable::Instantiate(const rrlib::xml::tNode& node, tFrameworkElement* parent)
 {
   std::string name = "component name not read";
   try
@@ -204,14 +218,15 @@ void tFinstructable::Instantiate(const rrlib::xml::tNode& node, tFrameworkElemen
 
     // create mode
     tFrameworkElement* created = NULL;
-    tConstructorParameters* spl = NULL;
-    if (constructor_params != NULL)
+    std::unique_ptr<tConstructorParameters> spl;
+    const tConstructorParameters* parameter_types = action.GetParameterTypes();
+    if (constructor_params != NULL && parameter_types)
     {
-      spl = action.GetParameterTypes()->Instantiate();
+      spl.reset(parameter_types->Instantiate());
       spl->Deserialize(*constructor_params, true);
     }
-    created = action.CreateModule(parent, name, spl);
-    SetFinstructed(*created, action, spl);
+    created = action.CreateModule(parent, name, spl.get());
+    SetFinstructed(*created, action, std::move(spl));
     if (parameters)
     {
       created->GetAnnotation<parameters::internal::tStaticParameterList>()->Deserialize(*parameters, true);
@@ -228,18 +243,20 @@ void tFinstructable::Instantiate(const rrlib::xml::tNode& node, tFrameworkElemen
       }
       else
       {
-        FINROC_LOG_PRINT(WARNING, "Unknown XML tag: ", name2);
+        FINROC_LOG_PRINT_STATIC(WARNING, "Unknown XML tag: ", name2);
       }
     }
+    return created;
   }
   catch (const rrlib::xml::tException& e)
   {
-    FINROC_LOG_PRINT(ERROR, "Failed to instantiate component '", name, "'. XML Exception: ", e.what(), ". Skipping.");
+    FINROC_LOG_PRINT_STATIC(ERROR, "Failed to instantiate component '", name, "'. XML Exception: ", e.what(), ". Skipping.");
   }
   catch (const std::exception& e)
   {
-    FINROC_LOG_PRINT(ERROR, "Failed to instantiate component '", name, "'. ", e.what(), ". Skipping.");
+    FINROC_LOG_PRINT_STATIC(ERROR, "Failed to instantiate component '", name, "'. ", e.what(), ". Skipping.");
   }
+  return NULL;
 }
 
 bool tFinstructable::IsResponsibleForConfigFileConnections(tFrameworkElement& ap) const
@@ -656,50 +673,64 @@ void tFinstructable::SerializeChildren(rrlib::xml::tNode& node, tFrameworkElemen
 {
   for (auto child = current.ChildrenBegin(); child != current.ChildrenEnd(); ++child)
   {
-    parameters::internal::tStaticParameterList* spl = child->GetAnnotation<parameters::internal::tStaticParameterList>();
-    tConstructorParameters* cps = child->GetAnnotation<tConstructorParameters>();
     if (child->IsReady() && child->GetFlag(tFlag::FINSTRUCTED))
     {
-      // serialize framework element
-      rrlib::xml::tNode& n = node.AddChildNode("element");
-      n.SetAttribute("name", child->GetName());
-      tCreateFrameworkElementAction* cma = tCreateFrameworkElementAction::GetConstructibleElements()[spl->GetCreateAction()];
-      n.SetAttribute("group", cma->GetModuleGroup().ToString());
-      //if (boost::ends_with(cma->GetModuleGroup(), ".so"))
-      //{
-      AddDependency(cma->GetModuleGroup());
-      //}
-      n.SetAttribute("type", cma->GetName());
-      if (cps != NULL)
-      {
-        rrlib::xml::tNode& pn = n.AddChildNode("constructor");
-        cps->Serialize(pn, true);
-      }
-      if (spl != NULL)
-      {
-        rrlib::xml::tNode& pn = n.AddChildNode("parameters");
-        spl->Serialize(pn, true);
-      }
-
-      // serialize its children
-      if (!child->GetFlag(tFlag::FINSTRUCTABLE_GROUP))
-      {
-        SerializeChildren(n, *child);
-      }
+      SerializeElement(node, *child);
     }
   }
 }
 
-void tFinstructable::SetFinstructed(tFrameworkElement& fe, tCreateFrameworkElementAction& create_action, tConstructorParameters* params)
+rrlib::xml::tNode* tFinstructable::SerializeElement(rrlib::xml::tNode& parent_node, tFrameworkElement& element)
+{
+  parameters::internal::tStaticParameterList* spl = element.GetAnnotation<parameters::internal::tStaticParameterList>();
+  tConstructorParameters* cps = element.GetAnnotation<tConstructorParameters>();
+  assert(spl && element.GetFlag(tFlag::FINSTRUCTED));
+  tCreateFrameworkElementAction* cma = tCreateFrameworkElementAction::GetConstructibleElements()[spl->GetCreateAction()];
+  if (!cma)
+  {
+    FINROC_LOG_PRINT_STATIC(ERROR, "Create action of element '", element.GetQualifiedName(), "' is no longer available. Element is not saved.");
+    return NULL;
+  }
+
+  // serialize framework element (node is only added once create action is known to exist - so that no incomplete node is written)
+  rrlib::xml::tNode& n = parent_node.AddChildNode("element");
+  n.SetAttribute("name", element.GetName());
+  const tCreateFrameworkElementAction::tIdentity& identity = cma->GetIdentity();
+  n.SetAttribute("group", identity.module_group_name);
+  //if (boost::ends_with(cma->GetModuleGroup(), ".so"))
+  //{
+  AddDependency(identity.module_group);
+  //}
+  n.SetAttribute("type", identity.name);
+  if (cps != NULL)
+  {
+    rrlib::xml::tNode& pn = n.AddChildNode("constructor");
+    cps->Serialize(pn, true);
+  }
+  if (spl != NULL)
+  {
+    rrlib::xml::tNode& pn = n.AddChildNode("parameters");
+    spl->Serialize(pn, true);
+  }
+
+  // serialize its children
+  if (!element.GetFlag(tFlag::FINSTRUCTABLE_GROUP))
+  {
+    SerializeChildren(n, element);
+  }
+  return &n;
+}
+
+void tFinstructable::SetFinstructed(tFrameworkElement& fe, tCreateFrameworkElementAction& create_action, std::unique_ptr<tConstructorParameters> params)
 {
   assert(!fe.GetFlag(tFlag::FINSTRUCTED) && (!fe.IsReady()));
   parameters::internal::tStaticParameterList& list = parameters::internal::tStaticParameterList::GetOrCreate(fe);
-  const std::vector<tCreateFrameworkElementAction*>& v = tCreateFrameworkElementAction::GetConstructibleElements();
-  list.SetCreateAction(static_cast<int>(std::find(v.begin(), v.end(), &create_action) - v.begin()));
+  list.SetCreateAction(static_cast<int>(create_action.GetIndex()));
+  fe.EmplaceAnnotation<tCreateFrameworkElementAction::tElementReference>(create_action);
   fe.SetFlag(tFlag::FINSTRUCTED);
   if (params)
   {
-    fe.AddAnnotation<tConstructorParameters>(*params);
+    fe.AddAnnotation<tConstructorParameters>(*tConstructorParameters::Share(static_cast<int>(create_action.GetIndex()), std::move(params)).release());
   }
 }
 
@@ -111,9 +111,43 @@ public:
    */
   static void AddDependency(const rrlib::rtti::tType& dt);
 
+  /*!
+   * Link edge of a port (see GetLinkEdges)
+   */
+  struct tLinkEdgeInfo
+  {
+    /*! Link that port is connected to */
+    std::string link;
+
+    /*! Is link the destination of the connection? (otherwise it is the source) */
+    bool link_is_destination;
+
+    /*! Was link edge created by finstruct? */
+    bool finstructed;
+  };
+
+  /*!
+   * Obtains link edges of port
+   * (link edges are not accessible via core's public API - tFinstructable is allowed to access them)
+   *
+   * \param port Port whose link edges to obtain
+   * \param result List to add port's link edges to
+   */
+  static void GetLinkEdges(const core::tAbstractPort& port, std::vector<tLinkEdgeInfo>& result);
+
   /*! for rrlib_logging */
   std::string GetLogDescription() const;
 
+  /*!
+   * Intantiates element (and its children) from XML node created by SerializeElement.
+   * The created element is initialized.
+   *
+   * \param node xml node that contains data for instantiation
+   * \param parent Parent element
+   * \return Created element (null if instantiation failed - error is logged)
+   */
+  static core::tFrameworkElement* Instantiate(const rrlib::xml::tNode& node, core::tFrameworkElement* parent);
+
   /*!
    * Loads and instantiates contents of xml file
    *
@@ -143,9 +177,19 @@ public:
    *
    * \param fe Framework element to mark
    * \param create_action Action with which framework element was created
-   * \param params Parameters that module was created with (may be null)
+   * \param params Parameters that module was created with (may be null; elements with identical parameters share values - see tConstructorParameters::Share)
+   */
+  static void SetFinstructed(core::tFrameworkElement& fe, tCreateFrameworkElementAction& create_action, std::unique_ptr<tConstructorParameters> params);
+
+  /*!
+   * Serializes finstructed element - together with its finstructed children - to a new 'element' child node
+   * (with group, type, constructor parameters and static parameters - as in .finroc files)
+   *
+   * \param parent_node XML node to add element node to
+   * \param element Element to serialize (must be flagged finstructed)
+   * \return Created element node - or NULL if element could not be serialized (no node is added then)
    */
-  static void SetFinstructed(core::tFrameworkElement& fe, tCreateFrameworkElementAction& create_action, tConstructorParameters* params);
+  static rrlib::xml::tNode* SerializeElement(rrlib::xml::tNode& parent_node, core::tFrameworkElement& element);
 
   /*!
    * \param main_name Default name when group is main part
@@ -213,14 +257,6 @@ private:
    */
   std::string GetXmlFileString();
 
-  /*!
-   * Intantiate element
-   *
-   * \param node xml node that contains data for instantiation
-   * \param parent Parent element
-   */
-  void Instantiate(const rrlib::xml::tNode& node, core::tFrameworkElement* parent);
-
   /*!
    * Is this finstructable group the one responsible for saving parameter's config entry?
    *
@@ -244,7 +280,7 @@ private:
    * \param node XML node to serialize to
    * \param current Framework element
    */
-  void SerializeChildren(rrlib::xml::tNode& node, core::tFrameworkElement& current);
+  static void SerializeChildren(rrlib::xml::tNode& node, core::tFrameworkElement& current);
 
   /*!
    * Recursive helper function for ScanForCommandLineArgs
@@ -37,6 +37,7 @@
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "plugins/runtime_construction/tStaticPortList.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -66,6 +67,52 @@ typedef core::tFrameworkElement::tFlags tFlags;
 //----------------------------------------------------------------------
 static const std::vector<tInterfaces::tStaticInterfaceInfo> cNO_STATIC_INTERFACE_INFO;
 
+namespace internal
+{
+
+/*!
+ * \param shared_interfaces Bitset that defines which interfaces should be shared
+ * \param interface_count Number of interfaces
+ * \return Vector with one entry per interface
+ */
+static std::vector<bool> ToVector(const std::bitset<tInterfaces::cMAX_INTERFACE_COUNT>& shared_interfaces, size_t interface_count)
+{
+  std::vector<bool> result(interface_count, false);
+  for (size_t i = 0; i < interface_count && i < shared_interfaces.size(); i++)
+  {
+    result[i] = shared_interfaces[i];
+  }
+  return result;
+}
+
+/*!
+ * \param shared_interfaces Defines which interfaces should be shared
+ * \param interface_count Number of interfaces
+ * \return Vector with exactly one entry per interface
+ */
+static std::vector<bool> Resize(std::vector<bool> shared_interfaces, size_t interface_count)
+{
+  shared_interfaces.resize(interface_count, false);
+  return shared_interfaces;
+}
+
+/*!
+ * \param static_interface_info Static info on interfaces
+ * \return Table with interface indices by name
+ */
+static std::unordered_map<std::string, int> CreateIndexByName(const std::vector<tInterfaces::tStaticInterfaceInfo>& static_interface_info)
+{
+  std::unordered_map<std::string, int> result;
+  result.reserve(static_interface_info.size());
+  for (size_t i = 0; i < static_interface_info.size(); i++)
+  {
+    result.emplace(static_interface_info[i].name, static_cast<int>(i));
+  }
+  return result;
+}
+
+}
+
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
@@ -73,7 +120,8 @@ static const std::vector<tInterfaces::tStaticInterfaceInfo> cNO_STATIC_INTERFACE
 tInterfaces::tInterfaces() :
   static_interface_info(cNO_STATIC_INTERFACE_INFO),
   interface_array(NULL),
-  shared_interfaces(0)
+  shared_interfaces(),
+  interface_index_by_name()
 {
   throw std::logic_error("This tEditableInterfaces constructor should never be called.");
 }
@@ -82,25 +130,38 @@ tInterfaces::tInterfaces(const std::vector<tStaticInterfaceInfo>& static_interfa
                          std::bitset<cMAX_INTERFACE_COUNT> shared_interfaces) :
   static_interface_info(static_interface_info),
   interface_array(interface_array),
-  shared_interfaces(shared_interfaces)
+  shared_interfaces(internal::ToVector(shared_interfaces, static_interface_info.size())),
+  interface_index_by_name(internal::CreateIndexByName(static_interface_info))
+{
+}
+
+tInterfaces::tInterfaces(const std::vector<tStaticInterfaceInfo>& static_interface_info, core::tPortGroup** interface_array,
+                         const std::vector<bool>& shared_interfaces) :
+  static_interface_info(static_interface_info),
+  interface_array(interface_array),
+  shared_interfaces(internal::Resize(shared_interfaces, static_interface_info.size())),
+  interface_index_by_name(internal::CreateIndexByName(static_interface_info))
 {
-  assert(static_interface_info.size() <= cMAX_INTERFACE_COUNT && "Maximum number of interfaces exceeded");
 }
 
 core::tPortGroup& tInterfaces::CreateInterface(core::tFrameworkElement* parent, size_t index, bool initialize) const
 {
+  if (index >= static_interface_info.size())
+  {
+    throw std::runtime_error("tEditableInterfaces::CreateInterface - Invalid index.");
+  }
   if (interface_array[index])
   {
     FINROC_LOG_PRINT(ERROR, "Interface already created.");
     return *(interface_array[index]);
   }
-  if (index >= static_interface_info.size())
-  {
-    throw new std::runtime_error("tEditableInterfaces::CreateInterface - Invalid index.");
-  }
 
   const tStaticInterfaceInfo& static_info = static_interface_info[index];
   interface_array[index] = new core::tPortGroup(parent, static_info.name, tFlag::INTERFACE | static_info.extra_interface_flags, GetDefaultPortFlags(index));
+  if (static_info.static_ports)
+  {
+    static_info.static_ports->AddPorts(*interface_array[index], GetDefaultPortFlags(index));
+  }
   if (initialize)
   {
     interface_array[index]->Init();
@@ -110,13 +171,19 @@ core::tPortGroup& tInterfaces::CreateInterface(core::tFrameworkElement* parent,
 
 tFlags tInterfaces::GetDefaultPortFlags(size_t interface_index) const
 {
-  if (interface_index > static_interface_info.size())
+  if (interface_index >= static_interface_info.size())
   {
-    throw new std::out_of_range("Index is out of bounds");
+    throw std::out_of_range("Index is out of bounds");
   }
   return static_interface_info[interface_index].default_port_flags | (shared_interfaces[interface_index] ? tFlags(tFlag::SHARED) : tFlags());
 }
 
+int tInterfaces::GetInterfaceIndex(const std::string& name) const
+{
+  auto it = interface_index_by_name.find(name);
+  return it != interface_index_by_name.end() ? it->second : -1;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
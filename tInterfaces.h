@@ -41,6 +41,7 @@
 //----------------------------------------------------------------------
 #include "core/port/tPortGroup.h"
 #include <bitset>
+#include <unordered_map>
 
 //----------------------------------------------------------------------
 // Internal includes with ""
@@ -81,6 +82,7 @@ constexpr tPortCreateOptions operator | (tPortCreateOption option1, tPortCreateO
 }
 
 class tEditableInterfaces;
+class tStaticPortListBase;
 
 //----------------------------------------------------------------------
 // Class declaration
@@ -98,7 +100,10 @@ class tInterfaces : public core::tAnnotation
 //----------------------------------------------------------------------
 public:
 
-  /*! Maximum number of editable interfaces */
+  /*!
+   * Number of interfaces that can be marked shared with the bitset constructor.
+   * Elements with more interfaces need to use the constructor taking a std::vector<bool>.
+   */
   enum { cMAX_INTERFACE_COUNT = 32 };
 
   /*!
@@ -118,6 +123,12 @@ public:
 
     /*! Which creation options should be visible and selectable in finstruct? */
     tPortCreateOptions selectable_create_options;
+
+    /*!
+     * Ports that interface always contains - for interfaces with (partly) fixed layout (nullptr if there are no such ports).
+     * They are created with their data types known at compile time whenever the interface is created (see tStaticPortList).
+     */
+    const tStaticPortListBase* static_ports;
   };
 
   /*! Should not be called. Exists for rrlib_rtti */
@@ -132,7 +143,15 @@ public:
               std::bitset<cMAX_INTERFACE_COUNT> shared_interfaces);
 
   /*!
-   * Creates interface according to this static interface info.
+   * \param static_interface_info Static info on editable interfaces (number of interfaces is not limited)
+   * \param interface_array Pointer to array (e.g. in group) containing editable interfaces - some entries may be null
+   * \param shared_interfaces Defines which interfaces should be shared with other runtime environments (missing entries are treated as false)
+   */
+  tInterfaces(const std::vector<tStaticInterfaceInfo>& static_interface_info, core::tPortGroup** interface_array,
+              const std::vector<bool>& shared_interfaces);
+
+  /*!
+   * Creates interface according to this static interface info - including its static ports.
    * Places interface in interface array provided in constructor
    *
    * \param parent Parent framework element
@@ -142,6 +161,12 @@ public:
    */
   core::tPortGroup& CreateInterface(core::tFrameworkElement* parent, size_t index, bool initialize) const;
 
+  /*!
+   * \param name Name of interface
+   * \return Index of interface with specified name - or -1 if there is no such interface
+   */
+  int GetInterfaceIndex(const std::string& name) const;
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -157,8 +182,11 @@ private:
   /*! Pointer to array (e.g. in group) containing editable interfaces - some entries may be null */
   core::tPortGroup** interface_array;
 
-  /*! Bitset that defines which interfaces should be shared with other runtime environments */
-  const std::bitset<cMAX_INTERFACE_COUNT> shared_interfaces;
+  /*! Defines which interfaces should be shared with other runtime environments (one entry per interface) */
+  const std::vector<bool> shared_interfaces;
+
+  /*! Interface indices by name (created in constructor - read-only afterwards) */
+  const std::unordered_map<std::string, int> interface_index_by_name;
 
   /*!
    * \interface_index Index of interface
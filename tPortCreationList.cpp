@@ -32,12 +32,17 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include "core/tRuntimeEnvironment.h"
 #include "core/port/tPortFactory.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
 #include "plugins/runtime_construction/tFinstructable.h"
+#include "plugins/runtime_construction/internal/tStructureRevision.h"
 
 //----------------------------------------------------------------------
 // Debugging
@@ -101,13 +106,45 @@ inline tFlags ToFlags(tPortCreateOptions create_options, tPortCreateOptions sele
   return result;
 }
 
+/*!
+ * Reads port type from stream - using the stream's type encoding
+ *
+ * \param stream Stream to read from
+ * \param port_name Name of port whose type is read (for error messages)
+ * \return Type that was read
+ * \throw std::runtime_error if type is not available
+ */
+static rrlib::rtti::tType ReadPortType(rrlib::serialization::tInputStream& stream, const std::string& port_name)
+{
+  rrlib::rtti::tType type;
+  std::string type_name;
+  if (stream.GetTypeEncoding() == rrlib::serialization::tTypeEncoding::NAMES)
+  {
+    type_name = stream.ReadString();
+    type = rrlib::rtti::tType::FindType(type_name);
+  }
+  else
+  {
+    stream >> type;
+    type_name = "(name not transferred with stream's type encoding)";
+  }
+  if (type == NULL)
+  {
+    FINROC_LOG_PRINT_STATIC(ERROR, "Error checking port from port creation deserialization: Type " + type_name + " of port " + port_name + " not available");
+    throw std::runtime_error("Error checking port from port creation list deserialization: Type " + type_name + " of port " + port_name + " not available");
+  }
+  return type;
+}
+
 
 tPortCreationList::tPortCreationList() :
   selectable_create_options(),
   list(),
   io_vector(NULL),
   flags(tFlags()),
-  ports_flagged_finstructed()
+  ports_flagged_finstructed(),
+  cached_ports(),
+  cached_ports_revision(internal::tStructureRevision::cINVALID_REVISION)
 {}
 
 tPortCreationList::tPortCreationList(core::tFrameworkElement& port_group, tFlags flags, const tPortCreateOptions& selectable_create_options, bool ports_flagged_finstructed) :
@@ -115,8 +152,11 @@ tPortCreationList::tPortCreationList(core::tFrameworkElement& port_group, tFlags
   list(),
   io_vector(&port_group),
   flags(flags | (ports_flagged_finstructed ? tFlag::FINSTRUCTED : tFlag::PORT)),
-  ports_flagged_finstructed(ports_flagged_finstructed)
+  ports_flagged_finstructed(ports_flagged_finstructed),
+  cached_ports(),
+  cached_ports_revision(internal::tStructureRevision::cINVALID_REVISION)
 {
+  internal::tStructureRevision::Register();
   if (!flags.Get(tFlag::SHARED) && selectable_create_options.Get(tPortCreateOption::SHARED))
   {
     this->selectable_create_options |= tPortCreateOption::SHARED;
@@ -130,46 +170,41 @@ tPortCreationList::tPortCreationList(core::tFrameworkElement& port_group, tFlags
 void tPortCreationList::Add(const std::string& name, rrlib::rtti::tType dt, const tPortCreateOptions& create_options)
 {
   rrlib::thread::tLock lock(io_vector->GetStructureMutex());
-  CheckPort(NULL, *io_vector, flags, name, dt, create_options, NULL);
+  std::vector<tCreatedPort> created_ports;
+  CheckPort(NULL, *io_vector, flags, name, dt, create_options, NULL, created_ports, false);
+  InitPorts(created_ports);
+  cached_ports_revision = internal::tStructureRevision::cINVALID_REVISION;
 }
 
 void tPortCreationList::ApplyChanges(core::tFrameworkElement& io_vector_, tFlags flags_)
 {
   rrlib::thread::tLock lock(io_vector->GetStructureMutex());
-  std::vector<core::tAbstractPort*> ports1;
-  GetPorts(*this->io_vector, ports1, ports_flagged_finstructed);
-  std::vector<core::tAbstractPort*> ports2;
-  GetPorts(io_vector_, ports2, ports_flagged_finstructed);
-
-  for (size_t i = 0u; i < ports1.size(); i++)
+  const std::vector<core::tAbstractPort*>& ports = GetManagedPorts();
+  std::vector<tEntry> entries;
+  entries.reserve(ports.size());
+  for (core::tAbstractPort * port : ports)
   {
-    core::tAbstractPort* ap1 = ports1[i];
-    core::tAbstractPort* ap2 = i < ports2.size() ? ports2[i] : NULL;
-    CheckPort(ap2, io_vector_, flags_, ap1->GetName(), ap1->GetDataType(), ToPortCreateOptions(ap1->GetAllFlags(), selectable_create_options), ap1);
-  }
-  for (size_t i = ports1.size(); i < ports2.size(); i++)
-  {
-    ports2[i]->ManagedDelete();
+    entries.emplace_back(port->GetName(), port->GetDataType(), ToPortCreateOptions(port->GetAllFlags(), selectable_create_options));
   }
+  SynchronizePorts(io_vector_, flags_, entries);
 }
 
 void tPortCreationList::CheckPort(core::tAbstractPort* existing_port, core::tFrameworkElement& io_vector, tFlags flags,
-                                  const std::string& name, rrlib::rtti::tType type, const tPortCreateOptions& create_options, core::tAbstractPort* prototype)
+                                  const std::string& name, rrlib::rtti::tType type, const tPortCreateOptions& create_options, core::tAbstractPort* prototype,
+                                  std::vector<tCreatedPort>& created_ports, bool recreate)
 {
-  if (existing_port && existing_port->NameEquals(name) && existing_port->GetDataType() == type &&
-      existing_port->GetFlag(tFlag::VOLATILE) == flags.Get(tFlag::VOLATILE))
+  if (existing_port && (!recreate) && PortMatches(*existing_port, flags, name, type, create_options))
   {
-    bool create_output_port = create_options.Get(tPortCreateOption::OUTPUT) || flags.Get(tFlag::OUTPUT_PORT);
-    bool create_shared_port = create_options.Get(tPortCreateOption::SHARED) || flags.Get(tFlag::SHARED);
-    if (((!selectable_create_options.Get(tPortCreateOption::OUTPUT)) || (existing_port->GetFlag(tFlag::OUTPUT_PORT) == create_output_port)) &&
-        ((!selectable_create_options.Get(tPortCreateOption::SHARED)) || (existing_port->GetFlag(tFlag::SHARED) == create_shared_port)))
-    {
-      // port is as it should be
-      return;
-    }
+    // port is as it should be
+    return;
   }
+  std::vector<tConnection> connections;
+  core::tFrameworkElement::tHandle replaced_port_handle = 0;
   if (existing_port)
   {
+    // port is replaced: keep its connections
+    SaveConnections(*existing_port, connections);
+    replaced_port_handle = existing_port->GetHandle();
     existing_port->ManagedDelete();
   }
 
@@ -185,7 +220,7 @@ void tPortCreationList::CheckPort(core::tAbstractPort* existing_port, core::tFra
   core::tAbstractPort* created_port = core::tPortFactory::CreatePort(name, io_vector, type, flags);
   if (created_port != NULL)
   {
-    created_port->Init();
+    created_ports.push_back(tCreatedPort { created_port, replaced_port_handle, std::move(connections) });
   }
 //  if (ap != NULL && listener != NULL)
 //  {
@@ -193,6 +228,41 @@ void tPortCreationList::CheckPort(core::tAbstractPort* existing_port, core::tFra
 //  }
 }
 
+bool tPortCreationList::PortMatches(core::tAbstractPort& existing_port, tFlags flags, const std::string& name, rrlib::rtti::tType type, const tPortCreateOptions& create_options) const
+{
+  if (existing_port.NameEquals(name) && existing_port.GetDataType() == type && existing_port.GetFlag(tFlag::VOLATILE) == flags.Get(tFlag::VOLATILE))
+  {
+    bool create_output_port = create_options.Get(tPortCreateOption::OUTPUT) || flags.Get(tFlag::OUTPUT_PORT);
+    bool create_shared_port = create_options.Get(tPortCreateOption::SHARED) || flags.Get(tFlag::SHARED);
+    return ((!selectable_create_options.Get(tPortCreateOption::OUTPUT)) || (existing_port.GetFlag(tFlag::OUTPUT_PORT) == create_output_port)) &&
+           ((!selectable_create_options.Get(tPortCreateOption::SHARED)) || (existing_port.GetFlag(tFlag::SHARED) == create_shared_port));
+  }
+  return false;
+}
+
+void tPortCreationList::CreateSnapshot(tPortCreationList& snapshot) const
+{
+  assert(snapshot.io_vector == NULL);
+  snapshot.selectable_create_options = selectable_create_options;
+  snapshot.list.clear();
+  if (!io_vector)
+  {
+    for (const tEntry & entry : list)
+    {
+      snapshot.list.emplace_back(entry.name, entry.type.Get(), entry.create_options);
+    }
+    return;
+  }
+
+  rrlib::thread::tLock lock(io_vector->GetStructureMutex());
+  const std::vector<core::tAbstractPort*>& ports = GetManagedPorts();
+  snapshot.list.reserve(ports.size());
+  for (core::tAbstractPort * port : ports)
+  {
+    snapshot.list.emplace_back(port->GetName(), port->GetDataType(), ToPortCreateOptions(port->GetAllFlags(), selectable_create_options));
+  }
+}
+
 void tPortCreationList::GetPorts(const core::tFrameworkElement& elem, std::vector<core::tAbstractPort*>& result, bool finstructed_ports_only)
 {
   result.clear();
@@ -205,36 +275,225 @@ void tPortCreationList::GetPorts(const core::tFrameworkElement& elem, std::vecto
   }
 }
 
+void tPortCreationList::InitPorts(std::vector<tCreatedPort>& created_ports)
+{
+  std::unordered_map<core::tFrameworkElement::tHandle, core::tAbstractPort*> replacements;
+  for (tCreatedPort & created_port : created_ports)
+  {
+    created_port.port->Init();
+    if (created_port.replaced_port_handle)
+    {
+      replacements[created_port.replaced_port_handle] = created_port.port;
+    }
+  }
+  for (tCreatedPort & created_port : created_ports)
+  {
+    if (created_port.connections.size())
+    {
+      RestoreConnections(*created_port.port, created_port.connections, replacements);
+    }
+  }
+}
+
+const std::vector<core::tAbstractPort*>& tPortCreationList::GetManagedPorts() const
+{
+  assert(io_vector);
+  uint64_t revision = internal::tStructureRevision::Get(*io_vector);
+  if (cached_ports_revision != revision)
+  {
+    GetPorts(*io_vector, cached_ports, ports_flagged_finstructed);
+    cached_ports_revision = revision;
+  }
+  return cached_ports;
+}
+
 int tPortCreationList::GetSize() const
 {
   if (!io_vector)
   {
     return list.size();
   }
-  int count = 0;
-  for (auto it = io_vector->ChildrenBegin(); it != io_vector->ChildrenEnd(); ++it)
+  rrlib::thread::tLock lock(io_vector->GetStructureMutex());
+  return GetManagedPorts().size();
+}
+
+void tPortCreationList::RestoreConnections(core::tAbstractPort& port, const std::vector<tConnection>& connections,
+    const std::unordered_map<core::tFrameworkElement::tHandle, core::tAbstractPort*>& replacements)
+{
+  typedef core::tAbstractPort::tConnectDirection tConnectDirection;
+  for (const tConnection & connection : connections)
   {
-    count++;
+    tConnectDirection direction = connection.partner_is_destination ? tConnectDirection::TO_TARGET : tConnectDirection::TO_SOURCE;
+    if (connection.partner_link.length() > 0)
+    {
+      port.ConnectTo(connection.partner_link, direction, connection.finstructed);
+      continue;
+    }
+
+    // partner might have been replaced by the same list operation (its connections to this port are stored with both ports)
+    auto replacement = replacements.find(connection.partner_handle);
+    core::tAbstractPort* partner = replacement != replacements.end() ? replacement->second : core::tRuntimeEnvironment::GetInstance().GetPort(connection.partner_handle);
+    if (!(partner && partner->IsReady()))
+    {
+      FINROC_LOG_PRINT_STATIC(WARNING, "Could not restore connection of replaced port '", port.GetQualifiedName(), "': partner port no longer exists.");
+      continue;
+    }
+    if (port.IsConnectedTo(*partner))
+    {
+      continue; // already restored from partner's side
+    }
+    port.ConnectTo(*partner, direction, connection.finstructed);
+    if (!port.IsConnectedTo(*partner))
+    {
+      FINROC_LOG_PRINT_STATIC(WARNING, "Could not restore connection of replaced port '", port.GetQualifiedName(), "' to '", partner->GetQualifiedName(), "'.");
+    }
+  }
+}
+
+void tPortCreationList::SaveConnections(core::tAbstractPort& port, std::vector<tConnection>& connections)
+{
+  for (auto it = port.OutgoingConnectionsBegin(); it != port.OutgoingConnectionsEnd(); ++it)
+  {
+    connections.push_back(tConnection { it->GetHandle(), std::string(), true, port.IsEdgeFinstructed(*it) });
+  }
+  for (auto it = port.IncomingConnectionsBegin(); it != port.IncomingConnectionsEnd(); ++it)
+  {
+    connections.push_back(tConnection { it->GetHandle(), std::string(), false, it->IsEdgeFinstructed(port) });
+  }
+  std::vector<tFinstructable::tLinkEdgeInfo> link_edges;
+  tFinstructable::GetLinkEdges(port, link_edges);
+  for (const tFinstructable::tLinkEdgeInfo & link_edge : link_edges)
+  {
+    connections.push_back(tConnection { 0, link_edge.link, link_edge.link_is_destination, link_edge.finstructed });
+  }
+}
+
+void tPortCreationList::SynchronizePorts(core::tFrameworkElement& io_vector, tFlags flags, const std::vector<tEntry>& entries)
+{
+  std::vector<core::tAbstractPort*> existing_ports;
+  GetPorts(io_vector, existing_ports, ports_flagged_finstructed);
+  if (&io_vector == this->io_vector)
+  {
+    cached_ports_revision = internal::tStructureRevision::cINVALID_REVISION;
+  }
+  std::unordered_multimap<std::string, std::pair<core::tAbstractPort*, size_t>> existing_ports_by_name(existing_ports.size());
+  for (size_t i = 0u; i < existing_ports.size(); i++)
+  {
+    existing_ports_by_name.emplace(existing_ports[i]->GetName(), std::make_pair(existing_ports[i], i));
+  }
+
+  // match existing ports by name
+  std::vector<std::pair<core::tAbstractPort*, size_t>> matching_ports(entries.size(), std::pair<core::tAbstractPort*, size_t>(NULL, 0));
+  for (size_t i = 0u; i < entries.size(); i++)
+  {
+    auto match = existing_ports_by_name.find(entries[i].name);
+    if (match != existing_ports_by_name.end())
+    {
+      matching_ports[i] = match->second;
+      existing_ports_by_name.erase(match);
+    }
+  }
+
+  // match remaining ports by type (renamed ports - they are replaced, but keep their connections)
+  std::unordered_map<std::string, std::deque<std::pair<core::tAbstractPort*, size_t>>> remaining_ports_by_type;
+  for (auto & remaining_port : existing_ports_by_name)
+  {
+    remaining_ports_by_type[remaining_port.second.first->GetDataType().GetName()].push_back(remaining_port.second);
+  }
+  for (auto & remaining_ports : remaining_ports_by_type)
+  {
+    std::sort(remaining_ports.second.begin(), remaining_ports.second.end(), [](const std::pair<core::tAbstractPort*, size_t>& p1, const std::pair<core::tAbstractPort*, size_t>& p2)
+    {
+      return p1.second < p2.second;
+    });
+  }
+  for (size_t i = 0u; i < entries.size(); i++)
+  {
+    if (!matching_ports[i].first)
+    {
+      auto remaining_ports = remaining_ports_by_type.find(entries[i].type.Get().GetName());
+      if (remaining_ports != remaining_ports_by_type.end() && remaining_ports->second.size())
+      {
+        matching_ports[i] = remaining_ports->second.front();
+        remaining_ports->second.pop_front();
+      }
+    }
+  }
+
+  // delete any remaining ports
+  for (auto & remaining_ports : remaining_ports_by_type)
+  {
+    for (auto & remaining_port : remaining_ports.second)
+    {
+      remaining_port.first->ManagedDelete();
+    }
+  }
+
+  // create or check ports - and initialize created ports in one batch.
+  // Only ports that changed are replaced. As core cannot move child elements, created ports are appended to io vector.
+  // Unchanged ports are only recreated if entries reorder them: all ports from the first port that would otherwise end up
+  // in front of a preceding unchanged port are recreated in order (keeping their connections).
+  std::vector<tCreatedPort> created_ports;
+  bool recreate = false;
+  bool kept_port = false;
+  size_t last_kept_position = 0;
+  for (size_t i = 0u; i < entries.size(); i++)
+  {
+    core::tAbstractPort* existing_port = matching_ports[i].first;
+    bool changed = (!existing_port) || (!PortMatches(*existing_port, flags, entries[i].name, entries[i].type.Get(), entries[i].create_options));
+    if ((!changed) && (!recreate))
+    {
+      if (kept_port && matching_ports[i].second < last_kept_position)
+      {
+        recreate = true;
+      }
+      else
+      {
+        kept_port = true;
+        last_kept_position = matching_ports[i].second;
+      }
+    }
+    CheckPort(existing_port, io_vector, flags, entries[i].name, entries[i].type.Get(), entries[i].create_options, NULL, created_ports, recreate);
+  }
+  InitPorts(created_ports);
+  if (&io_vector == this->io_vector)
+  {
+    cached_ports_revision = internal::tStructureRevision::cINVALID_REVISION;
   }
-  return count;
 }
 
 void tPortCreationList::InitialSetup(core::tFrameworkElement& managed_io_vector, tFlags port_creation_flags, const tPortCreateOptions& selectable_create_options)
 {
   assert((io_vector == NULL || io_vector == &managed_io_vector) && list.empty());
+  rrlib::thread::tLock lock(managed_io_vector.GetStructureMutex());
   io_vector = &managed_io_vector;
   flags = port_creation_flags;
   this->selectable_create_options = selectable_create_options;
+  cached_ports_revision = internal::tStructureRevision::cINVALID_REVISION;
+  internal::tStructureRevision::Register();
 }
 
-tPortCreationList::tEntry::tEntry(const std::string& name, const std::string& type, const tPortCreateOptions& create_options) :
+tPortCreationList::tEntry::tEntry(const std::string& name, rrlib::rtti::tType type, const tPortCreateOptions& create_options) :
   name(name),
   type(),
   create_options(create_options)
 {
-  rrlib::serialization::tStringInputStream sis(type);
-  sis >> this->type;
-  assert(this->type.Get() != NULL);
+  this->type.Set(type);
+}
+
+void tPortCreationList::Synchronize(const tPortCreationList& entries)
+{
+  assert(io_vector && (!entries.io_vector));
+  for (const tEntry & entry : entries.list)
+  {
+    if (entry.type.Get() == NULL)
+    {
+      FINROC_LOG_PRINT(ERROR, "Error synchronizing port list: Type of port " + entry.name + " not available");
+      throw std::runtime_error("Error synchronizing port list: Type of port " + entry.name + " not available");
+    }
+  }
+  rrlib::thread::tLock lock(io_vector->GetStructureMutex());
+  SynchronizePorts(*io_vector, flags, entries.list);
 }
 
 rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tPortCreationList& list)
@@ -248,22 +507,21 @@ rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputS
     {
       const tPortCreationList::tEntry& e = list.list[i];
       stream.WriteString(e.name);
-      stream.WriteString(e.type.Get().GetName());
+      stream << e.type.Get();
       stream.WriteByte(e.create_options.Raw());
     }
   }
   else
   {
     rrlib::thread::tLock lock(list.io_vector->GetStructureMutex());
-    std::vector<core::tAbstractPort*> ports;
-    list.GetPorts(*list.io_vector, ports, list.ports_flagged_finstructed);
+    const std::vector<core::tAbstractPort*>& ports = list.GetManagedPorts();
     int size = ports.size();
     stream.WriteInt(size);
     for (int i = 0; i < size; i++)
     {
       core::tAbstractPort* p = ports[i];
       stream.WriteString(p->GetName());
-      stream.WriteString(p->GetDataType().GetName());
+      stream << p->GetDataType();
       stream.WriteByte(ToPortCreateOptions(p->GetAllFlags(), list.selectable_create_options).Raw());
     }
   }
@@ -277,10 +535,11 @@ rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStr
     list.selectable_create_options = tPortCreateOptions(stream.ReadByte());
     size_t size = stream.ReadInt();
     list.list.clear();
+    list.list.reserve(size);
     for (size_t i = 0u; i < size; i++)
     {
       std::string name = stream.ReadString();
-      std::string type = stream.ReadString();
+      rrlib::rtti::tType type = ReadPortType(stream, name);
       list.list.emplace_back(name, type, tPortCreateOptions(stream.ReadByte()));
     }
   }
@@ -289,38 +548,17 @@ rrlib::serialization::tInputStream& operator >> (rrlib::serialization::tInputStr
     rrlib::thread::tLock lock(list.io_vector->GetStructureMutex());
     stream.ReadByte(); // skip selectable create options, as this is not defined by finstruct
     size_t size = stream.ReadInt();
-    std::vector<core::tAbstractPort*> existing_ports;
-    list.GetPorts(*list.io_vector, existing_ports, list.ports_flagged_finstructed);
+    std::vector<tPortCreationList::tEntry> entries;
+    entries.reserve(size);
     for (size_t i = 0u; i < size; i++)
     {
       std::string name = stream.ReadString();
-      std::string type_name = stream.ReadString();
-      rrlib::rtti::tType type = rrlib::rtti::tType::FindType(type_name);
-      if (type == NULL)
-      {
-        FINROC_LOG_PRINT_STATIC(ERROR, "Error checking port from port creation deserialization: Type " + type_name + " not available");
-        throw std::runtime_error("Error checking port from port creation list deserialization: Type " + type_name + " not available");
-      }
+      rrlib::rtti::tType type = ReadPortType(stream, name);
       tPortCreateOptions create_options(stream.ReadByte());
-
-      core::tAbstractPort* existing_port_with_this_name = NULL;
-      for (auto it = existing_ports.begin(); it != existing_ports.end(); ++it)
-      {
-        if ((*it)->GetName() == name)
-        {
-          existing_port_with_this_name = *it;
-          existing_ports.erase(it);
-          break;
-        }
-      }
-      list.CheckPort(existing_port_with_this_name, *list.io_vector, list.flags, name, type, create_options, NULL);
+      entries.emplace_back(name, type, create_options);
     }
 
-    // delete any remaining ports
-    for (size_t i = 0; i < existing_ports.size(); i++)
-    {
-      existing_ports[i]->ManagedDelete();
-    }
+    list.SynchronizePorts(*list.io_vector, list.flags, entries);
   }
   return stream;
 }
@@ -337,8 +575,7 @@ rrlib::xml::tNode& operator << (rrlib::xml::tNode& node, const tPortCreationList
   {
     node.SetAttribute("showOutputSelection", list.selectable_create_options.Get(tPortCreateOption::OUTPUT));
   }
-  std::vector<core::tAbstractPort*> ports;
-  list.GetPorts(*list.io_vector, ports, list.ports_flagged_finstructed);
+  const std::vector<core::tAbstractPort*>& ports = list.GetManagedPorts();
   int size = ports.size();
   for (int i = 0; i < size; i++)
   {
@@ -371,12 +608,9 @@ const rrlib::xml::tNode& operator >> (const rrlib::xml::tNode& node, tPortCreati
   {
     list.selectable_create_options.Set(tPortCreateOption::OUTPUT, node.GetBoolAttribute("showOutputSelection"));
   }
-  std::vector<core::tAbstractPort*> ports;
-  list.GetPorts(*list.io_vector, ports, list.ports_flagged_finstructed);
-  size_t i = 0u;
-  for (rrlib::xml::tNode::const_iterator port = node.ChildrenBegin(); port != node.ChildrenEnd(); ++port, ++i)
+  std::vector<tPortCreationList::tEntry> entries;
+  for (rrlib::xml::tNode::const_iterator port = node.ChildrenBegin(); port != node.ChildrenEnd(); ++port)
   {
-    core::tAbstractPort* ap = i < ports.size() ? ports[i] : NULL;
     std::string port_name = port->Name();
     assert(port_name.compare("port") == 0);
     tPortCreateOptions create_options;
@@ -392,15 +626,12 @@ const rrlib::xml::tNode& operator >> (const rrlib::xml::tNode& node, tPortCreati
     rrlib::rtti::tType dt = rrlib::rtti::tType::FindType(dt_name);
     if (dt == NULL)
     {
-      FINROC_LOG_PRINT_STATIC(ERROR, "Error checking port from port creation deserialization: Type " + dt_name + " not available");
-      throw std::runtime_error("Error checking port from port creation list deserialization: Type " + dt_name + " not available");
+      FINROC_LOG_PRINT_STATIC(ERROR, "Error checking port from port creation deserialization: Type " + dt_name + " of port " + port->GetStringAttribute("name") + " not available");
+      throw std::runtime_error("Error checking port from port creation list deserialization: Type " + dt_name + " of port " + port->GetStringAttribute("name") + " not available");
     }
-    list.CheckPort(ap, *list.io_vector, list.flags, port->GetStringAttribute("name"), dt, create_options, NULL);
-  }
-  for (; i < ports.size(); i++)
-  {
-    ports[i]->ManagedDelete();
+    entries.emplace_back(port->GetStringAttribute("name"), dt, create_options);
   }
+  list.SynchronizePorts(*list.io_vector, list.flags, entries);
 
   return node;
 }
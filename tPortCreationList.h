@@ -41,6 +41,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <unordered_map>
 #include "plugins/data_ports/tPort.h"
 
 //----------------------------------------------------------------------
@@ -115,6 +116,7 @@ public:
 
   /*!
    * Applies changes to another IO vector
+   * (see Synchronize on how ports are matched and on the resulting port order)
    *
    * \param io_vector Other io vector
    * \param flags Flags to use for port creation
@@ -122,7 +124,16 @@ public:
   void ApplyChanges(core::tFrameworkElement& io_vector, tFlags flags);
 
   /*!
-   * \return size of list
+   * Copies current content of this list to a list without io vector.
+   * Serializing the copy produces the same data as serializing this list -
+   * without requiring the structure mutex of this list's io vector.
+   *
+   * \param snapshot List to copy content to (must not wrap an io vector)
+   */
+  void CreateSnapshot(tPortCreationList& snapshot) const;
+
+  /*!
+   * \return size of list (for local lists: number of ports managed by this list)
    */
   int GetSize() const;
 
@@ -135,6 +146,20 @@ public:
    */
   void InitialSetup(core::tFrameworkElement& managed_io_vector, tFlags port_creation_flags, const tPortCreateOptions& selectable_create_options = tPortCreateOptions());
 
+  /*!
+   * Adjusts ports of this list's io vector so that they match the entries of another list.
+   * Ports are matched by name - remaining ports by data type (renamed ports) - so only ports that actually differ are created or deleted.
+   * Replaced ports (e.g. renamed ports or ports with changed data type) keep their connections.
+   *
+   * Limitation: as core cannot move child elements, new and replaced ports are appended to the io vector.
+   * So they end up behind the unchanged ports - even if entries list them in front of them (e.g. a port inserted at the front).
+   * Only if entries change the order of unchanged ports, ports are recreated (from the first misplaced port on) so that they are in the order of the entries.
+   *
+   * \param entries List without io vector (e.g. deserialized from a remote runtime or created with CreateSnapshot)
+   * \throw Throws std::runtime_error if entries contain data types not available in this runtime
+   */
+  void Synchronize(const tPortCreationList& entries);
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -155,14 +180,49 @@ private:
     /*! Port name */
     std::string name;
 
-    /*! Port type - as string (used remote) */
+    /*! Port type */
     tDataTypeReference type;
 
     /*! Port creation options for this specific port (e.g. output port? shared port?) */
     tPortCreateOptions create_options;
 
-    tEntry(const std::string& name, const std::string& type, const tPortCreateOptions& create_options);
+    tEntry(const std::string& name, rrlib::rtti::tType type, const tPortCreateOptions& create_options);
+
+  };
+
+  /*!
+   * Connection of a port that is replaced
+   * (so that it can be restored for the new port)
+   */
+  struct tConnection
+  {
+    /*! Handle of partner port (if connection is a direct connection) */
+    core::tFrameworkElement::tHandle partner_handle;
+
+    /*! Link to partner port (if connection is a link edge) - otherwise empty */
+    std::string partner_link;
+
+    /*! Is partner the destination of the connection? (otherwise it is the source) */
+    bool partner_is_destination;
+
+    /*! Was connection created by finstruct? */
+    bool finstructed;
+  };
+
+  /*!
+   * Port that has been created, but not initialized yet
+   * (ports are initialized in a batch - see InitPorts)
+   */
+  struct tCreatedPort
+  {
+    /*! Created port */
+    core::tAbstractPort* port;
+
+    /*! Handle of port that created port replaces (0 if port is new) */
+    core::tFrameworkElement::tHandle replaced_port_handle;
 
+    /*! Connections to restore after port has been initialized */
+    std::vector<tConnection> connections;
   };
 
   /*!
@@ -187,8 +247,18 @@ private:
    */
   bool ports_flagged_finstructed;
 
+  /*!
+   * Cached ports managed by this list (for local Runtimes - see GetManagedPorts).
+   * Only accessed with io_vector's structure mutex acquired.
+   */
+  mutable std::vector<core::tAbstractPort*> cached_ports;
+
+  /*! Revision of io_vector's children that cached_ports is valid for (tStructureRevision::cINVALID_REVISION if cache is invalid; only accessed with io_vector's structure mutex acquired) */
+  mutable uint64_t cached_ports_revision;
+
   /*!
    * Check whether we need to make adjustments to port
+   * (if existing port is replaced, its connections are restored for the new port)
    *
    * \param existing_port Port to check
    * \param io_vector Parent
@@ -197,9 +267,42 @@ private:
    * \param type new data type
    * \param create_options Selected create options for port
    * \param prototype Port prototype (only interesting for listener)
+   * \param created_ports If port is created, it is added to this list - without being initialized (see InitPorts)
+   * \param recreate Recreate existing port even if it matches (e.g. so that ports are in the correct order - connections are kept)
    */
   void CheckPort(core::tAbstractPort* existing_port, core::tFrameworkElement& io_vector, tFlags flags, const std::string& name,
-                 rrlib::rtti::tType type, const tPortCreateOptions& create_options, core::tAbstractPort* prototype);
+                 rrlib::rtti::tType type, const tPortCreateOptions& create_options, core::tAbstractPort* prototype,
+                 std::vector<tCreatedPort>& created_ports, bool recreate);
+
+  /*!
+   * \param existing_port Port to check
+   * \param flags Creation flags
+   * \param name Port name
+   * \param type Data type
+   * \param create_options Selected create options for port
+   * \return Whether existing port matches specified name, type and options (so that it does not need to be replaced)
+   */
+  bool PortMatches(core::tAbstractPort& existing_port, tFlags flags, const std::string& name, rrlib::rtti::tType type, const tPortCreateOptions& create_options) const;
+
+  /*!
+   * Restores connections of a replaced port.
+   * Connections that cannot be restored (e.g. because partner port was deleted) are logged.
+   *
+   * \param port New port (must be initialized)
+   * \param connections Connections of replaced port (see SaveConnections)
+   * \param replacements Ports replaced by the same list operation (handle of replaced port -> new port), so that connections between replaced ports are restored
+   */
+  static void RestoreConnections(core::tAbstractPort& port, const std::vector<tConnection>& connections,
+                                 const std::unordered_map<core::tFrameworkElement::tHandle, core::tAbstractPort*>& replacements);
+
+  /*!
+   * Stores connections of a port that is about to be replaced
+   * (e.g. because its data type or its output flag changes)
+   *
+   * \param port Port to be replaced
+   * \param connections List to add port's connections to
+   */
+  static void SaveConnections(core::tAbstractPort& port, std::vector<tConnection>& connections);
 
   /*!
    * Returns all child ports of specified framework element
@@ -209,6 +312,35 @@ private:
    * \param finstructed_ports_only Only retrieve finstructed ports?
    */
   static void GetPorts(const core::tFrameworkElement& elem, std::vector<core::tAbstractPort*>& result, bool finstructed_ports_only);
+
+  /*!
+   * Returns ports of io_vector that are managed by this list.
+   * Result is cached and only recomputed if child elements of io_vector have changed in the meantime (see tStructureRevision::Get(parent)).
+   * io_vector's structure mutex must be acquired when calling this and while using the result.
+   *
+   * \return Ports managed by this list
+   */
+  const std::vector<core::tAbstractPort*>& GetManagedPorts() const;
+
+  /*!
+   * Initializes all ports created by one list operation in a single batch.
+   * Connections of replaced ports are restored after all ports have been initialized.
+   *
+   * \param created_ports Ports created by CheckPort
+   */
+  static void InitPorts(std::vector<tCreatedPort>& created_ports);
+
+  /*!
+   * Adjusts ports of io vector so that they match the specified list of entries.
+   * Existing ports are matched by name using hash tables - ports without matching name by data type (see Synchronize).
+   * Ports that are not in the list are deleted, missing ports are created and existing ports are checked (see CheckPort).
+   * All ports are constructed first and then initialized in a single batch (see InitPorts).
+   *
+   * \param io_vector Io vector whose ports to adjust
+   * \param flags Creation flags
+   * \param entries Entries with ports that io vector should contain
+   */
+  void SynchronizePorts(core::tFrameworkElement& io_vector, tFlags flags, const std::vector<tEntry>& entries);
 };
 
 rrlib::serialization::tOutputStream& operator << (rrlib::serialization::tOutputStream& stream, const tPortCreationList& list);
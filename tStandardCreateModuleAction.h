@@ -89,6 +89,7 @@ public:
     type_name(type_name_)
   {
     group = GetBinary((void*)CreateModuleImplementation<T, Tdeprecated>::CreateModule);
+    Register();
   }
 
 
@@ -0,0 +1,228 @@
+//
+// You received this file as part of Finroc
+// A framework for intelligent robot control
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    plugins/runtime_construction/tStaticPortList.h
+ *
+ * \author  Max Reichardt
+ *
+ * \date    2026-10-18
+ *
+ * \brief   Contains tStaticPortList
+ *
+ * \b tStaticPortList
+ *
+ * List of ports whose data types are known at compile time.
+ * In contrast to tPortCreationList, port types are template arguments.
+ * Ports are therefore created directly as data_ports::tPort<T> -
+ * without any runtime type lookups or tPortFactory.
+ *
+ * Interfaces with fixed layout can declare their ports in tInterfaces::tStaticInterfaceInfo.
+ * They are then created whenever the interface is created:
+ *
+ *   static const tStaticPortList<double, int, std::string> cSTATUS_PORTS("Speed", tStaticPortDeclaration("Count", tPortCreateOption::OUTPUT), "Name");
+ *   static const std::vector<tInterfaces::tStaticInterfaceInfo> cINTERFACE_INFO = { { "Status", tFlags(), tFlags(), tPortCreateOptions(), &cSTATUS_PORTS } };
+ *
+ * The created ports are ordinary ports - so they are visible in and can be connected with finstruct as any other port.
+ * As they are not flagged finstructed, they are not part of an interface's editable port list (and are not saved to finstructable group files):
+ * they are always created from the declaration.
+ */
+//----------------------------------------------------------------------
+#ifndef __plugins__runtime_construction__tStaticPortList_h__
+#define __plugins__runtime_construction__tStaticPortList_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <array>
+#include "plugins/data_ports/tPort.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "plugins/runtime_construction/tInterfaces.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace finroc
+{
+namespace runtime_construction
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+/*!
+ * Name and create options of a single port in tStaticPortList
+ */
+struct tStaticPortDeclaration
+{
+  /*! Port name */
+  const char* name;
+
+  /*! Port creation options for this specific port (e.g. output port? shared port?) */
+  tPortCreateOptions create_options;
+
+  tStaticPortDeclaration(const char* name, const tPortCreateOptions& create_options = tPortCreateOptions()) :
+    name(name),
+    create_options(create_options)
+  {}
+
+  tStaticPortDeclaration(const char* name, tPortCreateOption create_option) :
+    name(name),
+    create_options(create_option)
+  {}
+};
+
+//! Base class of all static port lists
+/*!
+ * Allows creating ports of a tStaticPortList without knowing its data types (e.g. in tInterfaces)
+ */
+class tStaticPortListBase
+{
+public:
+
+  virtual ~tStaticPortListBase() {}
+
+  /*!
+   * Creates all ports in list - without initializing them
+   *
+   * \param parent Parent of ports (e.g. interface of group)
+   * \param flags Flags to assign to all ports (in addition to flags derived from port create options)
+   */
+  virtual void AddPorts(core::tFrameworkElement& parent, core::tFrameworkElement::tFlags flags) const = 0;
+};
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Port list with data types known at compile time
+/*!
+ * List of ports whose data types are known at compile time.
+ * Ports are created directly as data_ports::tPort<T> - without any runtime type lookups.
+ *
+ * \tparam TPortTypes Data types of ports (in the order of the port declarations)
+ */
+template <typename ... TPortTypes>
+class tStaticPortList : public tStaticPortListBase
+{
+  typedef core::tFrameworkElement::tFlag tFlag;
+  typedef core::tFrameworkElement::tFlags tFlags;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  /*! Number of ports in list */
+  enum { cSIZE = sizeof...(TPortTypes) };
+
+  /*! Array with (pointers to) created ports */
+  typedef std::array<core::tAbstractPort*, cSIZE> tCreatedPorts;
+
+  /*!
+   * \param port_declarations Port declarations - one for every port type (either port names or tStaticPortDeclaration objects)
+   */
+  template <typename ... TDeclarations>
+  tStaticPortList(const TDeclarations& ... port_declarations) :
+    declarations {{ tStaticPortDeclaration(port_declarations)... }}
+  {
+    static_assert(sizeof...(TDeclarations) == cSIZE, "There must be exactly one declaration for every port type");
+  }
+
+  /*!
+   * Creates all ports in list.
+   * All ports are constructed first and then initialized in a single batch (if 'initialize' is set).
+   *
+   * \param parent Parent of ports (e.g. interface of group)
+   * \param flags Flags to assign to all ports (in addition to flags derived from port create options)
+   * \param initialize Initialize ports? (should be false if parent is not initialized yet)
+   * \return Created ports
+   */
+  tCreatedPorts CreatePorts(core::tFrameworkElement& parent, tFlags flags = tFlags(), bool initialize = true) const
+  {
+    tCreatedPorts result;
+    rrlib::thread::tLock lock(parent.GetStructureMutex());
+    CreatePortsImplementation<0, TPortTypes...>(parent, flags | tFlag::ACCEPTS_DATA | tFlag::EMITS_DATA, result);
+    if (initialize)
+    {
+      for (core::tAbstractPort * port : result)
+      {
+        port->Init();
+      }
+    }
+    return result;
+  }
+
+  virtual void AddPorts(core::tFrameworkElement& parent, tFlags flags) const override
+  {
+    CreatePorts(parent, flags, false);
+  }
+
+  /*!
+   * \param index Index of port
+   * \return Declaration of port with specified index
+   */
+  const tStaticPortDeclaration& GetDeclaration(size_t index) const
+  {
+    return declarations[index];
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  /*! Port declarations - one for every port type */
+  std::array<tStaticPortDeclaration, cSIZE> declarations;
+
+  template <size_t INDEX>
+  void CreatePortsImplementation(core::tFrameworkElement& parent, tFlags flags, tCreatedPorts& result) const
+  {
+  }
+
+  template <size_t INDEX, typename T, typename ... TRest>
+  void CreatePortsImplementation(core::tFrameworkElement& parent, tFlags flags, tCreatedPorts& result) const
+  {
+    const tStaticPortDeclaration& declaration = declarations[INDEX];
+    tFlags port_flags = flags;
+    if (declaration.create_options.Get(tPortCreateOption::OUTPUT))
+    {
+      port_flags |= tFlag::OUTPUT_PORT;
+    }
+    if (declaration.create_options.Get(tPortCreateOption::SHARED))
+    {
+      port_flags |= tFlag::SHARED;
+    }
+    result[INDEX] = data_ports::tPort<T>(declaration.name, &parent, port_flags).GetWrapped();
+    CreatePortsImplementation<INDEX + 1, TRest...>(parent, flags, result);
+  }
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+
+#endif